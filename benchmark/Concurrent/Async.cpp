@@ -0,0 +1,72 @@
+//
+//  Async.cpp
+//  This file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Benchmark.hpp"
+
+#include <Concurrent/Async.hpp>
+
+#if defined(__cpp_impl_coroutine)
+
+#include <vector>
+
+namespace Concurrent
+{
+	static const std::size_t STACK_SIZE = 1024*16;
+	static const std::size_t TASKS = 100000;
+	
+	static Async<> wait_once(Condition & condition)
+	{
+		co_await condition;
+	}
+	
+	Benchmark::Suite AsyncBenchmarkSuite {
+		"Concurrent::Async", {
+			// Start a task which waits on a condition, and then wake it, as a coroutine and as a fiber:
+			{"wait",
+				[](Benchmark::Report & report) {
+					{
+						Condition condition;
+						std::vector<Async<>> tasks;
+						tasks.reserve(TASKS);
+						
+						auto duration = Benchmark::measure([&]{
+							for (std::size_t i = 0; i < TASKS; i += 1) {
+								tasks.push_back(wait_once(condition));
+								tasks.back().start();
+							}
+							
+							condition.resume();
+							tasks.clear();
+						});
+						
+						report.record("coroutine", duration * 1e9 / TASKS, "ns/task");
+					}
+					
+					{
+						Condition condition;
+						Stack::Arena arena(STACK_SIZE, TASKS);
+						
+						auto duration = Benchmark::measure([&]{
+							Fiber::Pool pool(arena);
+							
+							for (std::size_t i = 0; i < TASKS; i += 1) {
+								pool.resume([&]{condition.wait();});
+							}
+							
+							condition.resume();
+						});
+						
+						report.record("fiber", duration * 1e9 / TASKS, "ns/task");
+					}
+				}
+			},
+		}
+	};
+}
+
+#endif
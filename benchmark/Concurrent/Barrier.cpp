@@ -0,0 +1,46 @@
+//
+//  Barrier.cpp
+//  This file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Benchmark.hpp"
+
+#include <Concurrent/Barrier.hpp>
+#include <Concurrent/Scheduler.hpp>
+
+namespace Concurrent
+{
+	static const std::size_t STACK_SIZE = 1024*64;
+	
+	Benchmark::Suite BarrierBenchmarkSuite {
+		"Concurrent::Barrier", {
+			{"phases",
+				[](Benchmark::Report & report) {
+					const std::size_t FIBERS = 100, PHASES = 1000;
+					
+					for (auto concurrency : Benchmark::worker_counts()) {
+						Scheduler scheduler(concurrency, STACK_SIZE);
+						Barrier barrier(FIBERS);
+						
+						auto duration = Benchmark::measure([&]{
+							for (std::size_t i = 0; i < FIBERS; i += 1) {
+								scheduler.spawn([&]{
+									for (std::size_t phase = 0; phase < PHASES; phase += 1) {
+										barrier.arrive_and_wait();
+									}
+								});
+							}
+							
+							scheduler.wait();
+						});
+						
+						report.record("fibers=" + std::to_string(FIBERS) + " workers=" + std::to_string(concurrency), duration * 1e9 / PHASES, "ns/phase");
+					}
+				}
+			},
+		}
+	};
+}
@@ -0,0 +1,155 @@
+//
+//  Benchmark.cpp
+//  This file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Benchmark.hpp"
+
+#include <iostream>
+#include <fstream>
+#include <thread>
+#include <algorithm>
+
+#include <unistd.h>
+
+namespace Benchmark
+{
+	double Samples::mean() const
+	{
+		if (_values.empty()) return 0;
+		
+		double total = 0;
+		for (auto value : _values) total += value;
+		
+		return total / _values.size();
+	}
+	
+	double Samples::percentile(double fraction) const
+	{
+		if (_values.empty()) return 0;
+		
+		auto values = _values;
+		auto index = std::min<std::size_t>(fraction * values.size(), values.size() - 1);
+		
+		std::nth_element(values.begin(), values.begin() + index, values.end());
+		
+		return values[index];
+	}
+	
+	Report::Format Report::format = Report::Format::TSV;
+	
+	// Benchmark names are plain text, but may contain characters which need escaping:
+	static std::string quote(const std::string & string)
+	{
+		std::string quoted = "\"";
+		
+		for (auto character : string) {
+			if (character == '"' || character == '\\') quoted += '\\';
+			quoted += character;
+		}
+		
+		return quoted + "\"";
+	}
+	
+	void Report::record(const std::string & metric, double value, const std::string & unit)
+	{
+		if (format == Format::JSON) {
+			std::cout << "{\"suite\": " << quote(_suite) << ", \"benchmark\": " << quote(_benchmark) << ", \"metric\": " << quote(metric) << ", \"value\": " << value << ", \"unit\": " << quote(unit) << "}" << std::endl;
+		} else {
+			std::cout << _suite << '\t' << _benchmark << '\t' << metric << '\t' << value << '\t' << unit << std::endl;
+		}
+	}
+	
+	void Report::record(const std::string & metric, const Samples & samples, const std::string & unit)
+	{
+		record(metric + " p50", samples.percentile(0.5), unit);
+		record(metric + " p99", samples.percentile(0.99), unit);
+		record(metric + " mean", samples.mean(), unit);
+	}
+	
+	Memory Memory::current()
+	{
+		Memory memory;
+		
+#if defined(__linux__)
+		std::ifstream statm("/proc/self/statm");
+		std::size_t size = 0, resident = 0;
+		
+		if (statm >> size >> resident) {
+			memory.resident = resident * sysconf(_SC_PAGESIZE);
+		}
+		
+		std::ifstream maps("/proc/self/maps");
+		std::string line;
+		
+		while (std::getline(maps, line)) {
+			memory.mappings += 1;
+		}
+#endif
+		
+		return memory;
+	}
+	
+	std::vector<std::size_t> worker_counts()
+	{
+		std::vector<std::size_t> counts;
+		std::size_t maximum = std::max<std::size_t>(std::thread::hardware_concurrency(), 2);
+		
+		for (std::size_t count = 1; count < maximum; count *= 2) {
+			counts.push_back(count);
+		}
+		
+		counts.push_back(maximum);
+		
+		return counts;
+	}
+	
+	Suite::Suite(const std::string & name, std::initializer_list<Entry> entries) : _name(name), _entries(entries)
+	{
+		all().push_back(this);
+	}
+	
+	std::vector<Suite *> & Suite::all()
+	{
+		static std::vector<Suite *> suites;
+		
+		return suites;
+	}
+}
+
+// Runs all benchmarks, or only those whose "suite/benchmark" name contains one of the given arguments. The --json option writes each measurement as a JSON object.
+int main(int argc, char ** argv)
+{
+	std::vector<std::string> filters;
+	
+	for (int index = 1; index < argc; index += 1) {
+		std::string argument = argv[index];
+		
+		if (argument == "--json") {
+			Benchmark::Report::format = Benchmark::Report::Format::JSON;
+		} else {
+			filters.push_back(argument);
+		}
+	}
+	
+	for (auto suite : Benchmark::Suite::all()) {
+		for (auto & entry : suite->entries()) {
+			auto name = suite->name() + "/" + entry.name;
+			bool selected = filters.empty();
+			
+			for (auto & filter : filters) {
+				if (name.find(filter) != std::string::npos) selected = true;
+			}
+			
+			if (!selected) continue;
+			
+			Benchmark::Report report(suite->name(), entry.name);
+			entry.function(report);
+		}
+	}
+	
+	return 0;
+}
@@ -0,0 +1,122 @@
+//
+//  Benchmark.hpp
+//  This file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+namespace Benchmark
+{
+	typedef std::chrono::steady_clock Clock;
+	
+	// The durations of a number of operations, from which percentiles can be computed.
+	class Samples
+	{
+	public:
+		void add(double value) {_values.push_back(value);}
+		
+		std::size_t size() const noexcept {return _values.size();}
+		
+		double mean() const;
+		
+		// The value below which the given fraction of samples lie, e.g. 0.99 for p99.
+		double percentile(double fraction) const;
+		
+	private:
+		std::vector<double> _values;
+	};
+	
+	// Collects the measurements of a single benchmark, and writes them as tab separated lines: suite, benchmark, metric, value, unit. With --json, each measurement is written as a JSON object on a separate line instead.
+	class Report
+	{
+	public:
+		enum class Format {TSV, JSON};
+		
+		static Format format;
+		
+		Report(const std::string & suite, const std::string & benchmark) : _suite(suite), _benchmark(benchmark) {}
+		
+		void record(const std::string & metric, double value, const std::string & unit);
+		
+		// Records the p50, p99 and mean of the samples.
+		void record(const std::string & metric, const Samples & samples, const std::string & unit);
+		
+	private:
+		std::string _suite, _benchmark;
+	};
+	
+	// The memory used by the current process, as reported by the kernel. Both are zero on platforms where this isn't available.
+	struct Memory
+	{
+		// The resident set size, in bytes:
+		std::size_t resident = 0;
+		
+		// The number of virtual memory areas, which is limited by vm.max_map_count on Linux:
+		std::size_t mappings = 0;
+		
+		static Memory current();
+	};
+	
+	// Returns the wall-clock duration of the function, in seconds.
+	template <typename FunctionT>
+	double measure(FunctionT && function)
+	{
+		auto start = Clock::now();
+		
+		function();
+		
+		return std::chrono::duration<double>(Clock::now() - start).count();
+	}
+	
+	// Invokes the function count * batch times, and returns the duration of each batch divided by its size, in nanoseconds. Batching amortises the cost of reading the clock for very short operations.
+	template <typename FunctionT>
+	Samples sample(std::size_t count, std::size_t batch, FunctionT && function)
+	{
+		Samples samples;
+		
+		for (std::size_t i = 0; i < count; i += 1) {
+			auto start = Clock::now();
+			
+			for (std::size_t j = 0; j < batch; j += 1) {
+				function();
+			}
+			
+			samples.add(std::chrono::duration<double, std::nano>(Clock::now() - start).count() / batch);
+		}
+		
+		return samples;
+	}
+	
+	// Powers of two up to and including the hardware concurrency, and at least two:
+	std::vector<std::size_t> worker_counts();
+	
+	class Suite
+	{
+	public:
+		struct Entry
+		{
+			std::string name;
+			std::function<void(Report &)> function;
+		};
+		
+		Suite(const std::string & name, std::initializer_list<Entry> entries);
+		
+		static std::vector<Suite *> & all();
+		
+		const std::string & name() const noexcept {return _name;}
+		const std::vector<Entry> & entries() const noexcept {return _entries;}
+		
+	private:
+		std::string _name;
+		std::vector<Entry> _entries;
+	};
+}
@@ -0,0 +1,70 @@
+//
+//  Blocking.cpp
+//  This file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Benchmark.hpp"
+
+#include <Concurrent/Blocking.hpp>
+#include <Concurrent/Scheduler.hpp>
+
+#if defined(__linux__)
+
+namespace Concurrent
+{
+	static const std::size_t STACK_SIZE = 1024*64;
+	
+	Benchmark::Suite BlockingBenchmarkSuite {
+		"Concurrent::Blocking", {
+			// The round trip of an empty call, from a fiber woken by its reactor, and from scheduled fibers:
+			{"round-trip",
+				[](Benchmark::Report & report) {
+					const std::size_t CALLS = 10000;
+					
+					{
+						Blocking blocking(1);
+						Reactor reactor;
+						
+						auto duration = Benchmark::measure([&]{
+							Fiber fiber([&]{
+								for (std::size_t i = 0; i < CALLS; i += 1) {
+									blocking.run([]{});
+								}
+							});
+							
+							fiber.resume();
+							reactor.run();
+						});
+						
+						report.record("reactor", duration * 1e6 / CALLS, "us/call");
+					}
+					
+					for (auto concurrency : Benchmark::worker_counts()) {
+						Blocking blocking(concurrency);
+						Scheduler scheduler(concurrency, STACK_SIZE);
+						
+						auto duration = Benchmark::measure([&]{
+							for (std::size_t i = 0; i < CALLS; i += 1) {
+								scheduler.spawn([&]{
+									blocking.run([]{});
+								});
+							}
+							
+							scheduler.wait();
+						});
+						
+						auto statistics = blocking.statistics();
+						
+						report.record("workers=" + std::to_string(concurrency), duration * 1e6 / CALLS, "us/call");
+						report.record("workers=" + std::to_string(concurrency) + " peak depth", statistics.peak_depth, "calls");
+					}
+				}
+			},
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,163 @@
+//
+//  Channel.cpp
+//  This file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Benchmark.hpp"
+
+#include <Concurrent/Channel.hpp>
+#include <Concurrent/Queue.hpp>
+#include <Concurrent/Scheduler.hpp>
+
+#include <vector>
+
+namespace Concurrent
+{
+	static const std::size_t STACK_SIZE = 1024*64;
+	
+	Benchmark::Suite ChannelBenchmarkSuite {
+		"Concurrent::Channel", {
+			{"pipeline",
+				[](Benchmark::Report & report) {
+					const std::size_t VALUES = 1000000;
+					
+					// A single sender and receiver, with buffers ranging from direct handoff to plenty of slack:
+					for (std::size_t capacity : {1, 16, 1024}) {
+						for (auto concurrency : Benchmark::worker_counts()) {
+							Scheduler scheduler(concurrency, STACK_SIZE);
+							Channel<std::size_t> channel(capacity);
+							
+							auto duration = Benchmark::measure([&]{
+								scheduler.spawn([&]{
+									for (std::size_t value = 0; value < VALUES; value += 1) {
+										channel.send(value);
+									}
+									
+									channel.close();
+								});
+								
+								scheduler.spawn([&]{
+									std::size_t value;
+									while (channel.recv(value));
+								});
+								
+								scheduler.wait();
+							});
+							
+							report.record("capacity=" + std::to_string(capacity) + " workers=" + std::to_string(concurrency), duration * 1e9 / VALUES, "ns/value");
+						}
+					}
+				}
+			},
+			
+			{"batch",
+				[](Benchmark::Report & report) {
+					const std::size_t VALUES = 1000000, CAPACITY = 1024;
+					
+					for (std::size_t batch : {1, 16, 256}) {
+						for (auto concurrency : Benchmark::worker_counts()) {
+							Scheduler scheduler(concurrency, STACK_SIZE);
+							Channel<std::size_t> channel(CAPACITY);
+							
+							auto duration = Benchmark::measure([&]{
+								scheduler.spawn([&]{
+									std::vector<std::size_t> values(batch);
+									
+									for (std::size_t sent = 0; sent < VALUES; sent += batch) {
+										channel.send_n(values.begin(), batch);
+									}
+									
+									channel.close();
+								});
+								
+								scheduler.spawn([&]{
+									std::vector<std::size_t> values(batch);
+									while (channel.recv_n(values.begin(), batch));
+								});
+								
+								scheduler.wait();
+							});
+							
+							report.record("batch=" + std::to_string(batch) + " workers=" + std::to_string(concurrency), duration * 1e9 / VALUES, "ns/value");
+						}
+					}
+				}
+			},
+			
+			{"fan-in",
+				[](Benchmark::Report & report) {
+					const std::size_t SENDERS = 100, VALUES = 10000, CAPACITY = 64;
+					
+					for (auto concurrency : Benchmark::worker_counts()) {
+						Scheduler scheduler(concurrency, STACK_SIZE);
+						Channel<std::size_t> channel(CAPACITY);
+						std::atomic<std::size_t> remaining{SENDERS};
+						
+						auto duration = Benchmark::measure([&]{
+							for (std::size_t i = 0; i < SENDERS; i += 1) {
+								scheduler.spawn([&]{
+									for (std::size_t value = 0; value < VALUES; value += 1) {
+										channel.send(value);
+									}
+									
+									if (--remaining == 0) channel.close();
+								});
+							}
+							
+							scheduler.spawn([&]{
+								std::size_t value;
+								while (channel.recv(value));
+							});
+							
+							scheduler.wait();
+						});
+						
+						report.record("senders=" + std::to_string(SENDERS) + " workers=" + std::to_string(concurrency), duration * 1e9 / (SENDERS * VALUES), "ns/value");
+					}
+				}
+			},
+		}
+	};
+	
+	Benchmark::Suite QueueBenchmarkSuite {
+		"Concurrent::Queue", {
+			{"threads to fibers",
+				[](Benchmark::Report & report) {
+					const std::size_t VALUES = 1000000, CAPACITY = 1024;
+					
+					for (std::size_t threads : {1, 4}) {
+						Scheduler scheduler(1, STACK_SIZE);
+						Queue<std::size_t> queue(CAPACITY);
+						
+						auto duration = Benchmark::measure([&]{
+							scheduler.spawn([&]{
+								std::size_t value;
+								while (queue.recv(value));
+							});
+							
+							std::vector<std::thread> producers;
+							
+							for (std::size_t i = 0; i < threads; i += 1) {
+								producers.emplace_back([&]{
+									for (std::size_t value = 0; value < VALUES / threads; value += 1) {
+										queue.send(value);
+									}
+								});
+							}
+							
+							for (auto & producer : producers) producer.join();
+							
+							queue.close();
+							scheduler.wait();
+						});
+						
+						report.record("threads=" + std::to_string(threads), duration * 1e9 / VALUES, "ns/value");
+					}
+				}
+			},
+		}
+	};
+}
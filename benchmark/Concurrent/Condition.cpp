@@ -0,0 +1,206 @@
+//
+//  Condition.cpp
+//  This file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Benchmark.hpp"
+
+#include <Concurrent/Condition.hpp>
+#include <Concurrent/Fiber.hpp>
+#include <Concurrent/Loop.hpp>
+#include <Concurrent/Scheduler.hpp>
+
+#include <system_error>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Concurrent
+{
+	static const std::size_t STACK_SIZE = 1024*16;
+	static const std::size_t WAITER_COUNTS[] = {1, 100, 100000};
+	
+	// Start the given number of fibers which wait on the condition until done is set. Stacks are allocated from an arena, so the largest counts don't exceed the limit on memory mappings.
+	static bool start_waiters(Fiber::Pool & pool, Condition & condition, std::size_t count, const bool & done, Benchmark::Report & report)
+	{
+		try {
+			for (std::size_t i = 0; i < count; i += 1) {
+				pool.resume([&]{
+					while (!done && condition.wait());
+				});
+			}
+		} catch (const std::system_error & error) {
+			report.record("waiters=" + std::to_string(count) + " skipped", 0, error.what());
+			
+			return false;
+		}
+		
+		return true;
+	}
+	
+	Benchmark::Suite ConditionBenchmarkSuite {
+		"Concurrent::Condition", {
+			{"signal",
+				[](Benchmark::Report & report) {
+					const std::size_t SIGNALS = 1000000;
+					
+					for (auto count : WAITER_COUNTS) {
+						Stack::Arena arena(STACK_SIZE, count);
+						Fiber::Pool pool(arena);
+						Condition condition;
+						bool done = false;
+						
+						if (start_waiters(pool, condition, count, done, report)) {
+							// Each signal resumes the longest waiting fiber, which waits again at the back of the list:
+							auto samples = Benchmark::sample(SIGNALS / 100, 100, [&]{
+								condition.signal();
+							});
+							
+							report.record("waiters=" + std::to_string(count), samples, "ns/signal");
+						}
+						
+						done = true;
+						condition.resume();
+					}
+				}
+			},
+			
+			{"broadcast",
+				[](Benchmark::Report & report) {
+					const std::size_t WAKEUPS = 1000000;
+					
+					for (auto count : WAITER_COUNTS) {
+						Stack::Arena arena(STACK_SIZE, count);
+						Fiber::Pool pool(arena);
+						Condition condition;
+						bool done = false;
+						
+						if (start_waiters(pool, condition, count, done, report)) {
+							std::size_t rounds = (WAKEUPS + count - 1) / count;
+							
+							auto duration = Benchmark::measure([&]{
+								for (std::size_t i = 0; i < rounds; i += 1) {
+									condition.resume();
+								}
+							});
+							
+							report.record("waiters=" + std::to_string(count), duration * 1e9 / (rounds * count), "ns/waiter");
+						}
+						
+						done = true;
+						condition.resume();
+					}
+				}
+			},
+			
+			{"broadcast deferred",
+				[](Benchmark::Report & report) {
+					const std::size_t WAKEUPS = 1000000;
+					
+					// With a loop, waking the fibers only queues them, and they are resumed one at a time by the loop rather than on the waker's stack:
+					for (auto count : WAITER_COUNTS) {
+						Loop loop;
+						
+						Stack::Arena arena(STACK_SIZE, count);
+						Fiber::Pool pool(arena);
+						Condition condition;
+						bool done = false;
+						
+						if (start_waiters(pool, condition, count, done, report)) {
+							std::size_t rounds = (WAKEUPS + count - 1) / count;
+							double waking = 0;
+							
+							auto duration = Benchmark::measure([&]{
+								for (std::size_t i = 0; i < rounds; i += 1) {
+									waking += Benchmark::measure([&]{
+										condition.resume();
+									});
+									
+									loop.run();
+								}
+							});
+							
+							report.record("waiters=" + std::to_string(count) + " wake", waking * 1e9 / (rounds * count), "ns/waiter");
+							report.record("waiters=" + std::to_string(count), duration * 1e9 / (rounds * count), "ns/waiter");
+						}
+						
+						done = true;
+						condition.resume();
+						loop.run();
+					}
+				}
+			},
+			
+			{"shutdown",
+				[](Benchmark::Report & report) {
+					// Stopping fibers by raising Stop unwinds each stack, while asking them to stop lets each wait return false, so they return normally:
+					for (auto count : WAITER_COUNTS) {
+						for (bool requested : {false, true}) {
+							Stack::Arena arena(STACK_SIZE, count);
+							Condition condition;
+							std::unique_ptr<Fiber::Pool> pool(new Fiber::Pool(arena));
+							bool done = false;
+							
+							if (!start_waiters(*pool, condition, count, done, report)) break;
+							
+							auto duration = Benchmark::measure([&]{
+								if (requested) pool->request_stop();
+								
+								pool.reset();
+							});
+							
+							report.record("waiters=" + std::to_string(count) + (requested ? " request_stop" : " stop"), duration * 1e9 / count, "ns/fiber");
+						}
+					}
+				}
+			},
+			
+			{"shutdown scheduled",
+				[](Benchmark::Report & report) {
+					// Fibers run by a scheduler are removed from the condition by request_stop, on the calling thread, and return normally once a worker resumes them:
+					for (auto count : WAITER_COUNTS) {
+						Scheduler scheduler(2, STACK_SIZE);
+						Condition condition;
+						std::mutex lock;
+						std::vector<Fiber *> fibers;
+						std::size_t spawned = 0;
+						bool skipped = false;
+						
+						try {
+							for (; spawned < count; spawned += 1) {
+								scheduler.spawn([&]{
+									{
+										std::lock_guard<std::mutex> guard(lock);
+										fibers.push_back(Fiber::current);
+									}
+									
+									while (condition.wait());
+								});
+							}
+						} catch (const std::system_error & error) {
+							// Each stack is a separate mapping, so large counts can exceed vm.max_map_count:
+							report.record("waiters=" + std::to_string(count) + " skipped", 0, error.what());
+							skipped = true;
+						}
+						
+						while (condition.count() < spawned) std::this_thread::yield();
+						
+						auto duration = Benchmark::measure([&]{
+							for (auto fiber : fibers) fiber->request_stop();
+							
+							scheduler.wait();
+						});
+						
+						if (skipped) break;
+						
+						report.record("waiters=" + std::to_string(count) + " request_stop", duration * 1e9 / count, "ns/fiber");
+					}
+				}
+			},
+		}
+	};
+}
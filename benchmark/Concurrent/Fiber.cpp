@@ -0,0 +1,261 @@
+//
+//  Fiber.cpp
+//  This file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Benchmark.hpp"
+
+#include <Concurrent/Fiber.hpp>
+
+#include <memory>
+#include <vector>
+#include <functional>
+#include <system_error>
+
+namespace Concurrent
+{
+	static const std::size_t STACK_SIZES[] = {1024*16, 1024*64, Fiber::DEFAULT_STACK_SIZE};
+	
+	static std::string stack_size_name(std::size_t stack_size)
+	{
+		return "stack=" + std::to_string(stack_size / 1024) + "KiB";
+	}
+	
+	// Touch the given amount of stack, as a deep call would:
+	static void touch_stack(std::size_t size)
+	{
+		volatile char buffer[1024*16];
+		buffer[0] = 1;
+		
+		if (size > sizeof(buffer)) touch_stack(size - sizeof(buffer));
+		
+		buffer[1] = 1;
+	}
+	
+	Benchmark::Suite FiberBenchmarkSuite {
+		"Concurrent::Fiber", {
+			{"switch",
+				[](Benchmark::Report & report) {
+					bool done = false;
+					
+					Fiber fiber([&]{
+						while (!done) Fiber::current->yield();
+					});
+					
+					// Each operation is a resume into the fiber and a yield back out of it:
+					auto samples = Benchmark::sample(10000, 100, [&]{
+						fiber.resume();
+					});
+					
+					report.record("resume+yield", samples, "ns/op");
+					
+					done = true;
+					fiber.resume();
+				}
+			},
+			
+			// The cost of checking the budget in a hot loop, which reads the clock every Watchdog::Slice::CHECK_INTERVAL calls:
+			{"maybe_yield",
+				[](Benchmark::Report & report) {
+					Benchmark::Samples samples;
+					
+					Fiber fiber([&]{
+						samples = Benchmark::sample(10000, 100, [&]{
+							Fiber::maybe_yield();
+						});
+					});
+					
+					fiber.budget(Timer::Clock::duration::zero());
+					fiber.resume();
+					
+					report.record("check", samples, "ns/op");
+				}
+			},
+			
+			{"placement",
+				[](Benchmark::Report & report) {
+					const std::size_t COUNT = 1000;
+					const std::size_t STACK_SIZE = 1024*64;
+					
+					bool done = false;
+					
+					// Switching between many fibers in turn touches a different stack each time, which is where TLB misses and remote memory would show up:
+					auto measure = [&](const std::string & name, std::function<std::unique_ptr<Fiber>(std::function<void()>)> allocate) {
+						std::vector<std::unique_ptr<Fiber>> fibers;
+						
+						for (std::size_t i = 0; i < COUNT; i += 1) {
+							fibers.push_back(allocate([&]{
+								while (!done) Fiber::current->yield();
+							}));
+							
+							fibers.back()->resume();
+						}
+						
+						// Each batch resumes every fiber once, in turn:
+						std::size_t next = 0;
+						
+						auto samples = Benchmark::sample(100, COUNT, [&]{
+							fibers[next]->resume();
+							next = (next + 1) % COUNT;
+						});
+						
+						report.record(name + " fibers=" + std::to_string(COUNT), samples, "ns/op");
+						
+						done = true;
+						for (auto & fiber : fibers) fiber->resume();
+						done = false;
+					};
+					
+					for (auto node : {Stack::Options::ANY_NODE, Stack::Options::LOCAL_NODE}) {
+						Stack::Options options{node, false};
+						
+						measure(node == Stack::Options::ANY_NODE ? "mmap" : "mmap node=local", [&](std::function<void()> function) {
+							return std::unique_ptr<Fiber>(new Fiber(function, STACK_SIZE, options));
+						});
+						
+						for (bool huge_pages : {false, true}) {
+							options.huge_pages = huge_pages;
+							Stack::Arena arena(STACK_SIZE, COUNT, Stack::Arena::DEFAULT_GUARD_INTERVAL, options);
+							
+							auto name = std::string("arena") + (node == Stack::Options::ANY_NODE ? "" : " node=local") + (huge_pages ? " huge_pages" : "");
+							
+							measure(name, [&](std::function<void()> function) {
+								return std::unique_ptr<Fiber>(new Fiber(arena.allocate(), function));
+							});
+						}
+					}
+				}
+			},
+			
+			{"create",
+				[](Benchmark::Report & report) {
+					// Allocating the stack, running the fiber to completion and unmapping the stack:
+					for (auto stack_size : STACK_SIZES) {
+						auto samples = Benchmark::sample(1000, 10, [&]{
+							Fiber fiber([]{}, stack_size);
+							fiber.resume();
+						});
+						
+						report.record(stack_size_name(stack_size), samples, "ns/fiber");
+					}
+					
+					// Reusing a cached stack, with the fiber emplaced on it, which doesn't make any system calls or heap allocations:
+					Fiber::Pool pool(1024*16);
+					
+					auto samples = Benchmark::sample(1000, 10, [&]{
+						pool.resume([]{});
+					});
+					
+					report.record("pool " + stack_size_name(1024*16), samples, "ns/fiber");
+				}
+			},
+			
+			{"memory",
+				[](Benchmark::Report & report) {
+					// Each fiber yields once, so the top page of its stack has been touched, as it would be by any real fiber:
+					for (auto stack_size : STACK_SIZES) {
+						for (std::size_t count : {10000, 100000, 1000000}) {
+							auto name = stack_size_name(stack_size) + " fibers=" + std::to_string(count);
+							
+							std::vector<std::unique_ptr<Fiber>> fibers;
+							fibers.reserve(count);
+							
+							auto before = Benchmark::Memory::current();
+							
+							try {
+								auto duration = Benchmark::measure([&]{
+									for (std::size_t i = 0; i < count; i += 1) {
+										fibers.emplace_back(new Fiber([]{Fiber::current->yield();}, stack_size));
+										fibers.back()->resume();
+									}
+								});
+								
+								auto after = Benchmark::Memory::current();
+								
+								report.record(name + " create", duration * 1e9 / count, "ns/fiber");
+								report.record(name + " rss", double(after.resident - before.resident) / count, "bytes/fiber");
+								report.record(name + " mappings", double(after.mappings - before.mappings) / count, "mappings/fiber");
+							} catch (const std::system_error & error) {
+								// Each stack is a separate mapping with a guard page, so large counts can exceed vm.max_map_count:
+								report.record(name + " skipped after " + std::to_string(fibers.size()), 0, error.what());
+							}
+							
+							// Destroying suspended fibers stops them:
+							fibers.clear();
+						}
+					}
+					
+					// Stacks allocated from a single arena mapping, with a guard page every DEFAULT_GUARD_INTERVAL stacks:
+					for (std::size_t count : {10000, 100000}) {
+						auto name = "arena " + stack_size_name(1024*16) + " fibers=" + std::to_string(count);
+						
+						auto before = Benchmark::Memory::current();
+						
+						Stack::Arena arena(1024*16, count);
+						
+						std::vector<std::unique_ptr<Fiber>> fibers;
+						fibers.reserve(count);
+						
+						auto duration = Benchmark::measure([&]{
+							for (std::size_t i = 0; i < count; i += 1) {
+								fibers.emplace_back(new Fiber(arena.allocate(), []{Fiber::current->yield();}));
+								fibers.back()->resume();
+							}
+						});
+						
+						auto after = Benchmark::Memory::current();
+						
+						report.record(name + " create", duration * 1e9 / count, "ns/fiber");
+						report.record(name + " rss", double(after.resident - before.resident) / count, "bytes/fiber");
+						report.record(name + " mappings", double(after.mappings - before.mappings) / count, "mappings/fiber");
+						
+						fibers.clear();
+					}
+				}
+			},
+			
+			{"trim",
+				[](Benchmark::Report & report) {
+					const std::size_t COUNT = 10000;
+					
+					// Each fiber makes a deep call before waiting, which would otherwise keep its stack resident while it is idle:
+					for (std::size_t depth : {1024*16, 1024*64}) {
+						auto name = "depth=" + std::to_string(depth / 1024) + "KiB fibers=" + std::to_string(COUNT);
+						
+						Fiber::Pool pool(1024*128, 0);
+						Condition condition;
+						
+						auto before = Benchmark::Memory::current();
+						
+						for (std::size_t i = 0; i < COUNT; i += 1) {
+							pool.resume([&]{
+								touch_stack(depth);
+								condition.wait();
+							});
+						}
+						
+						auto resident = Benchmark::Memory::current();
+						
+						// The first check notes that every fiber has run, and the second trims them:
+						pool.trim(std::chrono::seconds(0));
+						
+						auto duration = Benchmark::measure([&]{
+							pool.trim(std::chrono::seconds(0));
+						});
+						
+						auto trimmed = Benchmark::Memory::current();
+						
+						report.record(name + " rss before", double(resident.resident - before.resident) / COUNT, "bytes/fiber");
+						report.record(name + " rss after", double(trimmed.resident - before.resident) / COUNT, "bytes/fiber");
+						report.record(name + " trim", duration * 1e9 / COUNT, "ns/fiber");
+						
+						condition.resume();
+					}
+				}
+			},
+		}
+	};
+}
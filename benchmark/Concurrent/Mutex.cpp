@@ -0,0 +1,114 @@
+//
+//  Mutex.cpp
+//  This file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Benchmark.hpp"
+
+#include <Concurrent/Mutex.hpp>
+#include <Concurrent/Scheduler.hpp>
+
+#include <mutex>
+
+namespace Concurrent
+{
+	static const std::size_t STACK_SIZE = 1024*64;
+	
+	// Fibers which repeatedly increment a shared counter, yielding while holding the lock every so often so that other fibers contend for it.
+	template <typename MutexT>
+	static double contend(std::size_t concurrency, std::size_t fibers, std::size_t iterations)
+	{
+		Scheduler scheduler(concurrency, STACK_SIZE);
+		MutexT mutex;
+		std::size_t counter = 0;
+		
+		return Benchmark::measure([&]{
+			for (std::size_t i = 0; i < fibers; i += 1) {
+				scheduler.spawn([&]{
+					for (std::size_t j = 0; j < iterations; j += 1) {
+						std::lock_guard<MutexT> lock(mutex);
+						
+						counter += 1;
+					}
+				});
+			}
+			
+			scheduler.wait();
+		});
+	}
+	
+	Benchmark::Suite MutexBenchmarkSuite {
+		"Concurrent::Mutex", {
+			{"uncontended",
+				[](Benchmark::Report & report) {
+					const std::size_t ITERATIONS = 10000000;
+					
+					Mutex mutex;
+					
+					auto duration = Benchmark::measure([&]{
+						for (std::size_t i = 0; i < ITERATIONS; i += 1) {
+							mutex.lock();
+							mutex.unlock();
+						}
+					});
+					
+					report.record("lock+unlock", duration * 1e9 / ITERATIONS, "ns/op");
+				}
+			},
+			
+			{"contended",
+				[](Benchmark::Report & report) {
+					const std::size_t FIBERS = 100, ITERATIONS = 10000;
+					
+					for (auto concurrency : Benchmark::worker_counts()) {
+						auto duration = contend<Mutex>(concurrency, FIBERS, ITERATIONS);
+						report.record("workers=" + std::to_string(concurrency), duration * 1e9 / (FIBERS * ITERATIONS), "ns/op");
+					}
+				}
+			},
+			
+			// The same workload using a mutex which blocks the worker thread, for comparison:
+			{"contended std::mutex",
+				[](Benchmark::Report & report) {
+					const std::size_t FIBERS = 100, ITERATIONS = 10000;
+					
+					for (auto concurrency : Benchmark::worker_counts()) {
+						auto duration = contend<std::mutex>(concurrency, FIBERS, ITERATIONS);
+						report.record("workers=" + std::to_string(concurrency), duration * 1e9 / (FIBERS * ITERATIONS), "ns/op");
+					}
+				}
+			},
+			
+			{"handoff",
+				[](Benchmark::Report & report) {
+					const std::size_t FIBERS = 100, ITERATIONS = 1000;
+					
+					// Holding the lock across a yield forces every other fiber to wait, so each unlock hands the mutex to a waiting fiber:
+					for (auto concurrency : Benchmark::worker_counts()) {
+						Scheduler scheduler(concurrency, STACK_SIZE);
+						Mutex mutex;
+						
+						auto duration = Benchmark::measure([&]{
+							for (std::size_t i = 0; i < FIBERS; i += 1) {
+								scheduler.spawn([&]{
+									for (std::size_t j = 0; j < ITERATIONS; j += 1) {
+										std::lock_guard<Mutex> lock(mutex);
+										
+										Scheduler::yield();
+									}
+								});
+							}
+							
+							scheduler.wait();
+						});
+						
+						report.record("workers=" + std::to_string(concurrency), duration * 1e9 / (FIBERS * ITERATIONS), "ns/handoff");
+					}
+				}
+			},
+		}
+	};
+}
@@ -0,0 +1,70 @@
+//
+//  Notification.cpp
+//  This file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Benchmark.hpp"
+
+#include <Concurrent/Notification.hpp>
+#include <Concurrent/Fiber.hpp>
+
+#if defined(__linux__)
+
+#include <atomic>
+#include <thread>
+
+namespace Concurrent
+{
+	Benchmark::Suite NotificationBenchmarkSuite {
+		"Concurrent::Notification", {
+			// Another thread signals a fiber on the reactor's thread. Signals which arrive together are combined, so the fiber is woken, and the doorbell written, far fewer times than it is signalled:
+			{"remote signal",
+				[](Benchmark::Report & report) {
+					const std::size_t SIGNALS = 100000;
+					
+					Reactor reactor;
+					Condition condition;
+					Notification notification(condition);
+					
+					std::atomic<bool> done{false};
+					std::size_t woken = 0;
+					
+					Fiber fiber([&]{
+						while (condition.wait()) {
+							woken += 1;
+						}
+					});
+					
+					fiber.resume();
+					
+					auto duration = Benchmark::measure([&]{
+						std::thread thread([&]{
+							for (std::size_t i = 0; i < SIGNALS; i += 1) {
+								notification.signal();
+							}
+							
+							done = true;
+						});
+						
+						while (!done || notification.pending()) {
+							reactor.update(1);
+						}
+						
+						thread.join();
+					});
+					
+					report.record("signals", SIGNALS / duration, "signals/s");
+					report.record("wakeups", woken, "fibers");
+					report.record("doorbell", double(reactor.wakeups()) / SIGNALS, "writes/signal");
+					
+					fiber.stop();
+				}
+			},
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,77 @@
+//
+//  Registry.cpp
+//  This file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Benchmark.hpp"
+
+#include <Concurrent/Fiber.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace Concurrent
+{
+	Benchmark::Suite RegistryBenchmarkSuite {
+		"Concurrent::Registry", {
+			// The cost of accounting on a resume and yield, for a fiber which isn't registered and one which is:
+			{"switch",
+				[](Benchmark::Report & report) {
+					bool done = false;
+					
+					auto function = [&]{
+						while (!done) Fiber::current->yield();
+					};
+					
+					Fiber unregistered(function);
+					
+					auto disabled = Benchmark::sample(10000, 100, [&]{
+						unregistered.resume();
+					});
+					
+					report.record("disabled", disabled, "ns/op");
+					
+					Registry::enable();
+					Fiber registered(function);
+					Registry::disable();
+					
+					auto enabled = Benchmark::sample(10000, 100, [&]{
+						registered.resume();
+					});
+					
+					report.record("enabled", enabled, "ns/op");
+					
+					done = true;
+					unregistered.resume();
+					registered.resume();
+				}
+			},
+			
+			// The cost of describing live fibers, without measuring their stacks:
+			{"snapshot",
+				[](Benchmark::Report & report) {
+					Registry::enable();
+					
+					std::vector<std::unique_ptr<Fiber>> fibers;
+					
+					for (std::size_t i = 0; i < 100; i += 1) {
+						fibers.emplace_back(new Fiber("idle", [&]{}));
+					}
+					
+					Registry::disable();
+					
+					auto snapshot = Benchmark::sample(100, 10, [&]{
+						Registry::snapshot(false);
+					});
+					
+					report.record("100 fibers", snapshot, "ns/op");
+					
+					for (auto & fiber : fibers) fiber->resume();
+				}
+			},
+		}
+	};
+}
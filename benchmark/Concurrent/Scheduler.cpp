@@ -0,0 +1,139 @@
+//
+//  Scheduler.cpp
+//  This file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Benchmark.hpp"
+
+#include <Concurrent/Scheduler.hpp>
+
+namespace Concurrent
+{
+	static const std::size_t STACK_SIZE = 1024*64;
+	
+	Benchmark::Suite SchedulerBenchmarkSuite {
+		"Concurrent::Scheduler", {
+			{"spawn",
+				[](Benchmark::Report & report) {
+					const std::size_t FIBERS = 100000;
+					
+					for (auto concurrency : Benchmark::worker_counts()) {
+						Scheduler scheduler(concurrency, STACK_SIZE);
+						
+						auto duration = Benchmark::measure([&]{
+							for (std::size_t i = 0; i < FIBERS; i += 1) {
+								scheduler.spawn([]{});
+							}
+							
+							scheduler.wait();
+						});
+						
+						report.record("workers=" + std::to_string(concurrency), FIBERS / duration, "fibers/s");
+					}
+				}
+			},
+			
+			{"yield",
+				[](Benchmark::Report & report) {
+					const std::size_t FIBERS = 1000, YIELDS = 100;
+					
+					for (auto concurrency : Benchmark::worker_counts()) {
+						Scheduler scheduler(concurrency, STACK_SIZE);
+						
+						auto duration = Benchmark::measure([&]{
+							for (std::size_t i = 0; i < FIBERS; i += 1) {
+								scheduler.spawn([&]{
+									for (std::size_t j = 0; j < YIELDS; j += 1) {
+										Scheduler::yield();
+									}
+								});
+							}
+							
+							scheduler.wait();
+						});
+						
+						report.record("workers=" + std::to_string(concurrency), (FIBERS * YIELDS) / duration, "yields/s");
+					}
+				}
+			},
+			
+			{"compute",
+				[](Benchmark::Report & report) {
+					const std::size_t FIBERS = 1000, SLICES = 10, ITERATIONS = 100000;
+					
+					for (auto concurrency : Benchmark::worker_counts()) {
+						Scheduler scheduler(concurrency, STACK_SIZE);
+						std::atomic<std::size_t> total{0};
+						
+						auto duration = Benchmark::measure([&]{
+							for (std::size_t i = 0; i < FIBERS; i += 1) {
+								scheduler.spawn([&, i]{
+									std::size_t value = i;
+									
+									for (std::size_t slice = 0; slice < SLICES; slice += 1) {
+										for (std::size_t j = 0; j < ITERATIONS; j += 1) {
+											value = value * 2862933555777941757ull + 3037000493ull;
+										}
+										
+										Scheduler::yield();
+									}
+									
+									total += value;
+								});
+							}
+							
+							scheduler.wait();
+						});
+						
+						report.record("workers=" + std::to_string(concurrency), FIBERS / duration, "fibers/s");
+					}
+				}
+			},
+			
+			{"ping-pong",
+				[](Benchmark::Report & report) {
+					const std::size_t PAIRS = 100, ROUNDS = 1000;
+					
+					for (auto concurrency : Benchmark::worker_counts()) {
+						Scheduler scheduler(concurrency, STACK_SIZE);
+						std::vector<std::unique_ptr<Condition>> conditions;
+						
+						for (std::size_t i = 0; i < PAIRS * 2; i += 1) {
+							conditions.emplace_back(new Condition);
+						}
+						
+						auto duration = Benchmark::measure([&]{
+							for (std::size_t i = 0; i < PAIRS; i += 1) {
+								auto & ping = *conditions[i * 2], & pong = *conditions[i * 2 + 1];
+								
+								// The receiving fiber is spawned first, and keeps resuming the sender until it has received each round:
+								scheduler.spawn([&]{
+									for (std::size_t round = 0; round < ROUNDS; round += 1) {
+										while (ping.count() == 0) Scheduler::yield();
+										ping.resume();
+										pong.wait();
+									}
+								});
+								
+								scheduler.spawn([&]{
+									for (std::size_t round = 0; round < ROUNDS; round += 1) {
+										ping.wait();
+										while (pong.count() == 0) Scheduler::yield();
+										pong.resume();
+									}
+								});
+							}
+							
+							scheduler.wait();
+						});
+						
+						report.record("workers=" + std::to_string(concurrency), (PAIRS * ROUNDS * 2) / duration, "wakeups/s");
+					}
+				}
+			},
+		}
+	};
+}
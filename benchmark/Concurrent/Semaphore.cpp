@@ -0,0 +1,51 @@
+//
+//  Semaphore.cpp
+//  This file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Benchmark.hpp"
+
+#include <Concurrent/Semaphore.hpp>
+#include <Concurrent/Scheduler.hpp>
+
+namespace Concurrent
+{
+	static const std::size_t STACK_SIZE = 1024*64;
+	
+	Benchmark::Suite SemaphoreBenchmarkSuite {
+		"Concurrent::Semaphore", {
+			{"contended",
+				[](Benchmark::Report & report) {
+					const std::size_t FIBERS = 100, ITERATIONS = 1000;
+					
+					// Fewer units than fibers, so most acquisitions wait for a unit to be handed over:
+					for (std::size_t units : {1, 4, 16}) {
+						for (auto concurrency : Benchmark::worker_counts()) {
+							Scheduler scheduler(concurrency, STACK_SIZE);
+							Semaphore semaphore(units);
+							
+							auto duration = Benchmark::measure([&]{
+								for (std::size_t i = 0; i < FIBERS; i += 1) {
+									scheduler.spawn([&]{
+										for (std::size_t j = 0; j < ITERATIONS; j += 1) {
+											semaphore.acquire();
+											Scheduler::yield();
+											semaphore.release();
+										}
+									});
+								}
+								
+								scheduler.wait();
+							});
+							
+							report.record("units=" + std::to_string(units) + " workers=" + std::to_string(concurrency), duration * 1e9 / (FIBERS * ITERATIONS), "ns/op");
+						}
+					}
+				}
+			},
+		}
+	};
+}
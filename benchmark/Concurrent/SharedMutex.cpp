@@ -0,0 +1,63 @@
+//
+//  SharedMutex.cpp
+//  This file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Benchmark.hpp"
+
+#include <Concurrent/SharedMutex.hpp>
+#include <Concurrent/Scheduler.hpp>
+
+#include <shared_mutex>
+
+namespace Concurrent
+{
+	static const std::size_t STACK_SIZE = 1024*64;
+	
+	Benchmark::Suite SharedMutexBenchmarkSuite {
+		"Concurrent::SharedMutex", {
+			{"read-mostly",
+				[](Benchmark::Report & report) {
+					const std::size_t FIBERS = 100, ITERATIONS = 10000;
+					
+					// One operation in every WRITES is a write:
+					for (std::size_t writes : {1000, 10}) {
+						for (auto concurrency : Benchmark::worker_counts()) {
+							Scheduler scheduler(concurrency, STACK_SIZE);
+							SharedMutex mutex;
+							std::size_t value = 0;
+							std::atomic<std::size_t> total{0};
+							
+							auto duration = Benchmark::measure([&]{
+								for (std::size_t i = 0; i < FIBERS; i += 1) {
+									scheduler.spawn([&, i]{
+										std::size_t sum = 0;
+										
+										for (std::size_t j = 0; j < ITERATIONS; j += 1) {
+											if ((i * ITERATIONS + j) % writes == 0) {
+												std::unique_lock<SharedMutex> lock(mutex);
+												value += 1;
+											} else {
+												std::shared_lock<SharedMutex> lock(mutex);
+												sum += value;
+											}
+										}
+										
+										total += sum;
+									});
+								}
+								
+								scheduler.wait();
+							});
+							
+							report.record("writes=1/" + std::to_string(writes) + " workers=" + std::to_string(concurrency), duration * 1e9 / (FIBERS * ITERATIONS), "ns/op");
+						}
+					}
+				}
+			},
+		}
+	};
+}
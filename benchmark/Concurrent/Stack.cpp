@@ -0,0 +1,76 @@
+//
+//  Stack.cpp
+//  This file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Benchmark.hpp"
+
+#include <Concurrent/Stack.hpp>
+
+namespace Concurrent
+{
+	Benchmark::Suite StackBenchmarkSuite {
+		"Concurrent::Stack", {
+			{"allocate",
+				[](Benchmark::Report & report) {
+					// Mapping and unmapping a stack, including its guard page:
+					for (std::size_t stack_size : {1024*16, 1024*64, 1024*1024, 1024*1024*4}) {
+						auto samples = Benchmark::sample(1000, 10, [&]{
+							Stack stack(stack_size);
+						});
+						
+						report.record("size=" + std::to_string(stack_size / 1024) + "KiB", samples, "ns/stack");
+					}
+				}
+			},
+			
+			{"arena",
+				[](Benchmark::Report & report) {
+					// Taking a slot from an arena and returning it, which doesn't make any system calls once the guard page is in place:
+					for (std::size_t stack_size : {1024*16, 1024*1024*4}) {
+						Stack::Arena arena(stack_size, 16);
+						
+						auto samples = Benchmark::sample(1000, 100, [&]{
+							Stack stack = arena.allocate();
+						});
+						
+						report.record("size=" + std::to_string(stack_size / 1024) + "KiB", samples, "ns/stack");
+					}
+				}
+			},
+			
+			{"used",
+				[](Benchmark::Report & report) {
+					// Measuring the high-water mark with mincore, which is the cost of tracking stack usage per fiber:
+					for (std::size_t stack_size : {1024*16, 1024*1024*4}) {
+						Stack stack(stack_size);
+						static_cast<volatile char *>(stack.top())[-1] = 0;
+						
+						auto samples = Benchmark::sample(1000, 10, [&]{
+							stack.used();
+						});
+						
+						report.record("size=" + std::to_string(stack_size / 1024) + "KiB", samples, "ns/stack");
+					}
+				}
+			},
+			
+			{"touch",
+				[](Benchmark::Report & report) {
+					// Writing to the first page of a fresh stack, which faults in a page as a fiber's first frame would:
+					for (std::size_t stack_size : {1024*16, 1024*1024*4}) {
+						auto samples = Benchmark::sample(1000, 10, [&]{
+							Stack stack(stack_size);
+							static_cast<volatile char *>(stack.top())[-1] = 0;
+						});
+						
+						report.record("size=" + std::to_string(stack_size / 1024) + "KiB", samples, "ns/stack");
+					}
+				}
+			},
+		}
+	};
+}
@@ -0,0 +1,48 @@
+//
+//  Trace.cpp
+//  This file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Benchmark.hpp"
+
+#include <Concurrent/Trace.hpp>
+
+namespace Concurrent
+{
+	Benchmark::Suite TraceBenchmarkSuite {
+		"Concurrent::Trace", {
+			// The cost of the hooks on a resume and yield, when recording is stopped and when it is started:
+			{"switch",
+				[](Benchmark::Report & report) {
+					bool done = false;
+					
+					Fiber fiber([&]{
+						while (!done) Fiber::current->yield();
+					});
+					
+					auto stopped = Benchmark::sample(10000, 100, [&]{
+						fiber.resume();
+					});
+					
+					report.record("stopped", stopped, "ns/op");
+					
+					Trace::start();
+					
+					auto started = Benchmark::sample(10000, 100, [&]{
+						fiber.resume();
+					});
+					
+					Trace::stop();
+					
+					report.record("started", started, "ns/op");
+					
+					done = true;
+					fiber.resume();
+				}
+			},
+		}
+	};
+}
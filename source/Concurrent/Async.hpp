@@ -0,0 +1,431 @@
+//
+//  Async.hpp
+//  File file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+// Stackless coroutines require C++20. In earlier modes, this header is empty, so that the rest of the library doesn't depend on it.
+#if defined(__cpp_impl_coroutine)
+
+#include "Condition.hpp"
+#include "Channel.hpp"
+#include "Fiber.hpp"
+
+#include <coroutine>
+#include <exception>
+#include <utility>
+#include <optional>
+#include <type_traits>
+
+namespace Concurrent
+{
+	// Suspends a coroutine until the condition is signalled or resumed. The coroutine is linked into the same list as waiting fibers, from its own frame, so awaiting doesn't allocate. It is resumed directly by whichever fiber wakes it, on that fiber's stack and thread.
+	class ConditionAwaiter : private Condition::Node
+	{
+	public:
+		explicit ConditionAwaiter(Condition & condition) noexcept : Condition::Node(nullptr), _condition(condition)
+		{
+			Condition::Node::wake = &ConditionAwaiter::wake;
+		}
+		
+		// A coroutine which is destroyed while it is waiting is removed from the condition:
+		~ConditionAwaiter()
+		{
+			if (_waiting) _condition.remove(*this);
+		}
+		
+		ConditionAwaiter(const ConditionAwaiter & other) = delete;
+		ConditionAwaiter & operator=(const ConditionAwaiter & other) = delete;
+		
+		bool await_ready() const noexcept {return false;}
+		
+		void await_suspend(std::coroutine_handle<> handle)
+		{
+			_handle = handle;
+			_waiting = true;
+			
+			_condition.push(*this);
+		}
+		
+		/// @returns false if the condition was destroyed while the coroutine was waiting.
+		bool await_resume() const noexcept {return !_stopped;}
+		
+	private:
+		static void wake(Condition::Node & node, bool stopped)
+		{
+			auto & awaiter = static_cast<ConditionAwaiter &>(node);
+			
+			awaiter._waiting = false;
+			awaiter._stopped = stopped;
+			
+			awaiter._handle.resume();
+		}
+		
+		Condition & _condition;
+		std::coroutine_handle<> _handle;
+		
+		bool _waiting = false;
+		bool _stopped = false;
+	};
+	
+	inline ConditionAwaiter operator co_await(Condition & condition) noexcept
+	{
+		return ConditionAwaiter(condition);
+	}
+	
+	// Suspends a coroutine until the fiber has completed.
+	class FiberAwaiter : public ConditionAwaiter
+	{
+	public:
+		explicit FiberAwaiter(Fiber & fiber) noexcept : ConditionAwaiter(fiber.completion()), _fiber(fiber) {}
+		
+		// A fiber which is finishing has already resumed its waiters:
+		bool await_ready() const noexcept
+		{
+			return _fiber.status() == Status::FINISHING || _fiber.status() == Status::FINISHED;
+		}
+		
+	private:
+		Fiber & _fiber;
+	};
+	
+	// Fiber can be implicitly constructed from any function, including other awaitables, so this only matches fibers exactly:
+	template <typename FiberT, typename = std::enable_if_t<std::is_same<FiberT, Fiber>::value>>
+	FiberAwaiter operator co_await(FiberT & fiber) noexcept
+	{
+		return FiberAwaiter(fiber);
+	}
+	
+	// Suspends a coroutine until a value can be received from the channel. The coroutine is linked into the same list as receiving fibers, from its own frame, and is resumed directly by whichever fiber or coroutine sends to the channel, on its stack and thread.
+	template <typename Type>
+	class ChannelReceiver : private Waiters::Waiter
+	{
+	public:
+		explicit ChannelReceiver(Channel<Type> & channel) noexcept : Waiters::Waiter(nullptr), _channel(channel)
+		{
+			Waiters::Waiter::wake = &ChannelReceiver::wake;
+		}
+		
+		// A coroutine which is destroyed while it is waiting is removed from the channel:
+		~ChannelReceiver()
+		{
+			if (_waiting) _channel._receivers.remove(*this, _channel._lock);
+		}
+		
+		ChannelReceiver(const ChannelReceiver & other) = delete;
+		ChannelReceiver & operator=(const ChannelReceiver & other) = delete;
+		
+		bool await_ready() const noexcept {return false;}
+		
+		// The coroutine doesn't suspend if a value is available, or the channel is closed. Once it is waiting, it may be resumed by another thread, so nothing here can be used afterwards:
+		bool await_suspend(std::coroutine_handle<> handle)
+		{
+			_handle = handle;
+			_waiting = true;
+			
+			if (receive()) {
+				_waiting = false;
+				
+				return false;
+			}
+			
+			return true;
+		}
+		
+		/// @returns the value, or nothing if the channel is closed and all values have been received, or was destroyed while the coroutine was waiting.
+		std::optional<Type> await_resume() {return std::move(_value);}
+		
+	private:
+		bool receive()
+		{
+			return _channel.recv_or_wait(*this, [this](Type && value){
+				_value.emplace(std::move(value));
+			});
+		}
+		
+		static void wake(Waiters::Waiter & waiter, bool stopped)
+		{
+			auto & receiver = static_cast<ChannelReceiver &>(waiter);
+			
+			// Another receiver may have taken the value first, in which case this one waits again:
+			if (stopped || receiver.receive()) {
+				receiver._waiting = false;
+				receiver._handle.resume();
+			}
+		}
+		
+		Channel<Type> & _channel;
+		std::coroutine_handle<> _handle;
+		std::optional<Type> _value;
+		
+		bool _waiting = false;
+	};
+	
+	template <typename Type>
+	ChannelReceiver<Type> operator co_await(Channel<Type> & channel) noexcept
+	{
+		return ChannelReceiver<Type>(channel);
+	}
+	
+	// Suspends a coroutine until the value can be sent to the channel, which holds the value in the meantime. Like ChannelReceiver, the coroutine waits alongside sending fibers.
+	template <typename Type>
+	class ChannelSender : private Waiters::Waiter
+	{
+	public:
+		ChannelSender(Channel<Type> & channel, Type value) : Waiters::Waiter(nullptr), _channel(channel), _value(std::move(value))
+		{
+			Waiters::Waiter::wake = &ChannelSender::wake;
+		}
+		
+		// A coroutine which is destroyed while it is waiting is removed from the channel:
+		~ChannelSender()
+		{
+			if (_waiting) _channel._senders.remove(*this, _channel._lock);
+		}
+		
+		ChannelSender(const ChannelSender & other) = delete;
+		ChannelSender & operator=(const ChannelSender & other) = delete;
+		
+		bool await_ready() const noexcept {return false;}
+		
+		bool await_suspend(std::coroutine_handle<> handle)
+		{
+			_handle = handle;
+			_waiting = true;
+			
+			if (send()) {
+				_waiting = false;
+				
+				return false;
+			}
+			
+			return true;
+		}
+		
+		/// @returns false if the channel was closed, or destroyed while the coroutine was waiting, in which case the value was not sent.
+		bool await_resume() const noexcept {return _sent;}
+		
+	private:
+		bool send()
+		{
+			return _channel.send_or_wait(*this, _value, _sent);
+		}
+		
+		static void wake(Waiters::Waiter & waiter, bool stopped)
+		{
+			auto & sender = static_cast<ChannelSender &>(waiter);
+			
+			// Another sender may have taken the space first, in which case this one waits again:
+			if (stopped || sender.send()) {
+				sender._waiting = false;
+				sender._handle.resume();
+			}
+		}
+		
+		Channel<Type> & _channel;
+		std::coroutine_handle<> _handle;
+		Type _value;
+		
+		bool _sent = false;
+		bool _waiting = false;
+	};
+	
+	/// Send a value from a coroutine, suspending it while the channel is full, e.g. `co_await send(channel, value)`.
+	template <typename Type>
+	ChannelSender<Type> send(Channel<Type> & channel, std::type_identity_t<Type> value)
+	{
+		return ChannelSender<Type>(channel, std::move(value));
+	}
+	
+	// A stackless coroutine which produces a value. It starts when it is first awaited, either by another coroutine using co_await, or by a fiber using get, and runs on the stack of whoever starts or wakes it. Its frame is allocated by the compiler, and is typically a few hundred bytes, so it suits small tasks which don't nest deeply.
+	template <typename Type = void>
+	class Async
+	{
+		// Holds the result of the coroutine, which is moved out when it is awaited.
+		template <typename ResultT>
+		struct Result
+		{
+			std::optional<ResultT> value;
+			
+			template <typename ValueT>
+			void return_value(ValueT && value_)
+			{
+				value.emplace(std::forward<ValueT>(value_));
+			}
+			
+			ResultT take() {return std::move(*value);}
+		};
+		
+		template <typename ResultT>
+		struct Result<ResultT &>
+		{
+			ResultT * value = nullptr;
+			
+			void return_value(ResultT & value_) noexcept {value = &value_;}
+			
+			ResultT & take() noexcept {return *value;}
+		};
+		
+	public:
+		struct promise_type;
+		typedef std::coroutine_handle<promise_type> Handle;
+		
+	private:
+		// Once the coroutine has completed, resume whichever coroutine or fiber is waiting for it.
+		struct Completion
+		{
+			bool await_ready() const noexcept {return false;}
+			
+			std::coroutine_handle<> await_suspend(Handle handle) noexcept
+			{
+				auto & promise = handle.promise();
+				
+				// A fiber which is woken may destroy the coroutine, so nothing else in its frame can be used afterwards:
+				auto continuation = promise.continuation;
+				promise.completion.signal();
+				
+				if (continuation) return continuation;
+				
+				return std::noop_coroutine();
+			}
+			
+			void await_resume() const noexcept {}
+		};
+		
+		struct Base
+		{
+			Condition completion;
+			std::coroutine_handle<> continuation;
+			std::exception_ptr exception;
+			bool started = false;
+			
+			std::suspend_always initial_suspend() const noexcept {return {};}
+			Completion final_suspend() const noexcept {return {};}
+			
+			void unhandled_exception() noexcept
+			{
+				exception = std::current_exception();
+			}
+		};
+		
+		template <typename ResultT, typename = void>
+		struct Promise : public Base, public Result<ResultT>
+		{
+			ResultT take()
+			{
+				if (this->exception) std::rethrow_exception(this->exception);
+				
+				return Result<ResultT>::take();
+			}
+		};
+		
+		template <typename VoidT>
+		struct Promise<void, VoidT> : public Base
+		{
+			void return_void() const noexcept {}
+			
+			void take()
+			{
+				if (this->exception) std::rethrow_exception(this->exception);
+			}
+		};
+		
+	public:
+		struct promise_type : public Promise<Type>
+		{
+			Async get_return_object() noexcept
+			{
+				return Async(Handle::from_promise(*this));
+			}
+		};
+		
+		Async() noexcept {}
+		Async(Async && other) noexcept : _handle(std::exchange(other._handle, nullptr)) {}
+		
+		Async & operator=(Async && other) noexcept
+		{
+			if (this != &other) {
+				if (_handle) _handle.destroy();
+				_handle = std::exchange(other._handle, nullptr);
+			}
+			
+			return *this;
+		}
+		
+		// Destroying a coroutine which hasn't completed destroys its frame, including anything it is awaiting.
+		~Async()
+		{
+			if (_handle) _handle.destroy();
+		}
+		
+		/// Whether the coroutine has completed.
+		bool done() const noexcept {return _handle.done();}
+		
+		/// Run the coroutine until it first suspends, if it hasn't been started already.
+		void start()
+		{
+			auto & promise = _handle.promise();
+			
+			if (!promise.started) {
+				promise.started = true;
+				_handle.resume();
+			}
+		}
+		
+		/// Suspend the current fiber until the coroutine completes, starting it if necessary.
+		/// @returns the coroutine's result, or raises the exception it exited with. If the fiber is asked to stop before the coroutine completes, Stop is raised.
+		Type get()
+		{
+			start();
+			
+			while (!_handle.done()) {
+				if (!_handle.promise().completion.wait()) throw Stop();
+			}
+			
+			return _handle.promise().take();
+		}
+		
+		// Suspends a coroutine until this one completes, starting it if necessary by transferring control to it directly.
+		struct Awaiter
+		{
+			Handle handle;
+			
+			bool await_ready() const noexcept {return handle.done();}
+			
+			std::coroutine_handle<> await_suspend(std::coroutine_handle<> continuation) noexcept
+			{
+				auto & promise = handle.promise();
+				promise.continuation = continuation;
+				
+				if (!promise.started) {
+					promise.started = true;
+					
+					return handle;
+				}
+				
+				return std::noop_coroutine();
+			}
+			
+			Type await_resume()
+			{
+				return handle.promise().take();
+			}
+		};
+		
+		Awaiter operator co_await() const noexcept
+		{
+			return Awaiter{_handle};
+		}
+		
+	private:
+		explicit Async(Handle handle) noexcept : _handle(handle) {}
+		
+		Handle _handle;
+	};
+}
+
+#endif
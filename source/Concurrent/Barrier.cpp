@@ -0,0 +1,60 @@
+//
+//  Barrier.cpp
+//  File file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Barrier.hpp"
+
+#include <cassert>
+
+namespace Concurrent
+{
+	bool Barrier::arrive()
+	{
+		assert(_remaining > 0);
+		
+		_remaining -= 1;
+		
+		if (_remaining != 0) return false;
+		
+		_phase += 1;
+		_remaining = _expected;
+		
+		// Fibers which arrive for the next phase are queued behind these, and are not woken:
+		auto waiting = _waiters.count();
+		_lock.unlock();
+		
+		_waiters.wake(waiting, _lock);
+		
+		return true;
+	}
+	
+	void Barrier::arrive_and_wait()
+	{
+		_lock.lock();
+		
+		auto phase = _phase;
+		
+		if (arrive()) return;
+		
+		do {
+			_waiters.wait(_lock);
+			_lock.lock();
+		} while (phase == _phase);
+		
+		_lock.unlock();
+	}
+	
+	void Barrier::arrive_and_drop()
+	{
+		_lock.lock();
+		
+		assert(_expected > 0);
+		_expected -= 1;
+		
+		if (!arrive()) _lock.unlock();
+	}
+}
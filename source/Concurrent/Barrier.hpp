@@ -0,0 +1,51 @@
+//
+//  Barrier.hpp
+//  File file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Waiters.hpp"
+
+namespace Concurrent
+{
+	// Suspends fibers until the expected number have arrived, then wakes them all and resets for the next phase.
+	class Barrier
+	{
+	public:
+		explicit Barrier(std::size_t expected) noexcept : _expected(expected), _remaining(expected) {}
+		
+		Barrier(const Barrier & other) = delete;
+		Barrier & operator=(const Barrier & other) = delete;
+		
+		/// Arrive at the barrier and suspend the current fiber until the phase completes.
+		void arrive_and_wait();
+		
+		/// Arrive at the barrier, and reduce the number of fibers expected in subsequent phases.
+		void arrive_and_drop();
+		
+		/// The number of phases which have completed.
+		std::size_t phase() const noexcept
+		{
+			std::lock_guard<Spinlock> lock(_lock);
+			
+			return _phase;
+		}
+		
+	private:
+		// Decrement the remaining count, with the lock held. If this completes the phase, the lock is released and the waiting fibers are woken.
+		// @returns whether the phase was completed.
+		bool arrive();
+		
+		mutable Spinlock _lock;
+		
+		std::size_t _expected;
+		std::size_t _remaining;
+		std::size_t _phase = 0;
+		
+		Waiters _waiters;
+	};
+}
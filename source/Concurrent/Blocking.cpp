@@ -0,0 +1,256 @@
+//
+//  Blocking.cpp
+//  File file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Blocking.hpp"
+#include "Scheduler.hpp"
+
+#if defined(__linux__)
+
+namespace Concurrent
+{
+	constexpr std::size_t Blocking::DEFAULT_THREADS;
+	constexpr std::size_t Blocking::DEFAULT_CAPACITY;
+	
+	Blocking::Blocking(std::size_t threads, std::size_t capacity) : _capacity(capacity)
+	{
+		if (threads == 0) threads = 1;
+		if (_capacity == 0) _capacity = 1;
+		
+		_statistics.threads = threads;
+		
+		for (std::size_t index = 0; index < threads; index += 1) {
+			_threads.emplace_back(&Blocking::work, this);
+		}
+	}
+	
+	Blocking::~Blocking()
+	{
+		{
+			std::lock_guard<std::mutex> lock(_lock);
+			_stopping = true;
+		}
+		
+		_ready.notify_all();
+		
+		for (auto & thread : _threads) {
+			thread.join();
+		}
+	}
+	
+	Blocking & Blocking::shared()
+	{
+		static Blocking blocking;
+		
+		return blocking;
+	}
+	
+	Blocking::Statistics Blocking::statistics() const
+	{
+		std::lock_guard<std::mutex> lock(_lock);
+		
+		return _statistics;
+	}
+	
+	void Blocking::submit(std::unique_ptr<Job> & pointer)
+	{
+		auto & job = *pointer;
+		auto fiber = Fiber::current;
+		auto scheduler = fiber->scheduler();
+		auto reactor = Reactor::current();
+		
+		// There is no other fiber which could run while this one waits:
+		if (scheduler == nullptr && (reactor == nullptr || fiber->status() == Status::MAIN)) {
+			try {
+				job.execute(job);
+			} catch (...) {
+				job.exception = std::current_exception();
+			}
+			
+			return;
+		}
+		
+		job.fiber = fiber;
+		job.scheduler = scheduler;
+		
+		if (scheduler) {
+			job.lock.lock();
+			
+			push(job);
+			
+			// The helper thread can't schedule the fiber until it has been switched out and the lock released:
+			while (!job.done) {
+				Scheduler::suspend(job.lock);
+				job.lock.lock();
+			}
+			
+			job.lock.unlock();
+		} else {
+			job.reactor = reactor;
+			job.invoke = [](Reactor::Task & task) {
+				auto & job = static_cast<Job &>(task);
+				
+				// The fiber was stopped after the call completed, and may no longer exist. The job was detached on this thread, so the pool's lock isn't needed:
+				if (job.detached) {
+					delete &job;
+					
+					return;
+				}
+				
+				job.done = true;
+				job.fiber->schedule();
+			};
+			
+			push(job);
+			
+			while (!job.done) {
+				try {
+					reactor->suspend();
+				} catch (Stop) {
+					// The fiber is being unwound, and may be destroyed without being resumed again, so the call can't wait for it:
+					if (!job.done) detach(pointer);
+					
+					throw;
+				}
+			}
+		}
+	}
+	
+	void Blocking::detach(std::unique_ptr<Job> & job)
+	{
+		std::lock_guard<std::mutex> lock(_lock);
+		
+		if (job->linked()) {
+			// The call hasn't started, so it is discarded:
+			job->unlink();
+			
+			if (!job->backlogged) {
+				_statistics.depth -= 1;
+				advance();
+			}
+		} else {
+			job->detached = true;
+			job.release();
+		}
+	}
+	
+	void Blocking::push(Job & job)
+	{
+		{
+			std::lock_guard<std::mutex> lock(_lock);
+			
+			job.submitted = Timer::Clock::now();
+			_statistics.submitted += 1;
+			
+			// The caller is suspended until the call completes, so it waits for space without spinning, which would stall the other fibers of its thread:
+			if (_statistics.depth >= _capacity) {
+				job.backlogged = true;
+				_backlog.push_back(job);
+				
+				_statistics.full += 1;
+				
+				return;
+			}
+			
+			enqueue(job);
+		}
+		
+		_ready.notify_one();
+	}
+	
+	void Blocking::enqueue(Job & job)
+	{
+		_queue.push_back(job);
+		_statistics.depth += 1;
+		
+		if (_statistics.depth > _statistics.peak_depth) {
+			_statistics.peak_depth = _statistics.depth;
+		}
+	}
+	
+	void Blocking::advance()
+	{
+		if (_backlog.empty()) return;
+		
+		auto & job = static_cast<Job &>(*_backlog.next);
+		job.unlink();
+		job.backlogged = false;
+		
+		enqueue(job);
+	}
+	
+	void Blocking::complete(Job & job)
+	{
+		if (job.scheduler) {
+			job.lock.lock();
+			
+			job.done = true;
+			auto fiber = job.fiber;
+			auto scheduler = job.scheduler;
+			
+			job.lock.unlock();
+			
+			scheduler->schedule(fiber);
+		} else {
+			job.reactor->post(job);
+		}
+	}
+	
+	void Blocking::work()
+	{
+		std::unique_lock<std::mutex> lock(_lock);
+		
+		while (true) {
+			// Queued calls are completed before stopping, as their fibers are waiting for them:
+			_ready.wait(lock, [&]{return _stopping || !_queue.empty();});
+			
+			if (_queue.empty()) break;
+			
+			auto & job = static_cast<Job &>(*_queue.next);
+			job.unlink();
+			
+			auto started = Timer::Clock::now();
+			
+			_statistics.depth -= 1;
+			advance();
+			_statistics.running += 1;
+			_statistics.waiting += started - job.submitted;
+			
+			lock.unlock();
+			
+			try {
+				job.execute(job);
+			} catch (...) {
+				job.exception = std::current_exception();
+			}
+			
+			auto finished = Timer::Clock::now();
+			
+			lock.lock();
+			
+			_statistics.running -= 1;
+			_statistics.completed += 1;
+			_statistics.executing += finished - started;
+			
+			// Nothing is waiting for the result, so the job is freed here rather than posted:
+			if (job.detached) {
+				lock.unlock();
+				delete &job;
+				lock.lock();
+				
+				continue;
+			}
+			
+			// The calling fiber may resume and return as soon as the job is completed, so it is counted first:
+			lock.unlock();
+			complete(job);
+			lock.lock();
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,215 @@
+//
+//  Blocking.hpp
+//  File file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Fiber.hpp"
+#include "Reactor.hpp"
+#include "Spinlock.hpp"
+#include "Timer.hpp"
+#include "Link.hpp"
+
+#include <exception>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <vector>
+
+namespace Concurrent
+{
+#if defined(__linux__)
+	class Scheduler;
+	
+	// A bounded pool of helper threads which run blocking calls, e.g. getaddrinfo, compression or stat, on behalf of fibers, so that they don't stall the other fibers of the calling thread. The calling fiber is suspended until the call completes: a fiber run by a Scheduler is made ready by the helper thread, while any other fiber is woken by the Reactor of its thread. Each call, including the function and its result, is allocated rather than stored on the calling fiber's stack, so that it can outlive the fiber if the fiber is stopped.
+	class Blocking
+	{
+		template <typename FunctionT>
+		using Result = decltype(std::declval<typename std::decay<FunctionT>::type &>()());
+		
+	public:
+		static constexpr std::size_t DEFAULT_THREADS = 4;
+		static constexpr std::size_t DEFAULT_CAPACITY = 1024;
+		
+		/// @param threads the number of helper threads.
+		/// @param capacity the number of calls which can be queued waiting for a helper thread. Beyond this, calls wait for space in a backlog, while their callers stay suspended.
+		Blocking(std::size_t threads = DEFAULT_THREADS, std::size_t capacity = DEFAULT_CAPACITY);
+		
+		// Waits for all queued calls to complete, then stops the helper threads.
+		~Blocking();
+		
+		Blocking(const Blocking & other) = delete;
+		Blocking & operator=(const Blocking & other) = delete;
+		
+		/// The pool used by Concurrent::blocking, which is created on first use.
+		static Blocking & shared();
+		
+		/// Run the function on a helper thread, suspending the current fiber until it returns. If the current fiber is not run by a scheduler, and its thread has no reactor, e.g. it is the main fiber, there is nothing else to run, so the function is called directly.
+		/// The call can't be interrupted, so if the fiber is stopped while it waits, a call which is still queued is discarded, while one which is running is detached: Stop is raised at once, and the function keeps running on the helper thread, so it must not refer to the fiber's stack if the fiber may be stopped or destroyed.
+		/// @returns the result of the function, or raises the exception it exited with.
+		template <typename FunctionT>
+		Result<FunctionT> run(FunctionT && function)
+		{
+			typedef Call<Result<FunctionT>, typename std::decay<FunctionT>::type> CallT;
+			
+			std::unique_ptr<Job> call(new CallT(std::forward<FunctionT>(function)));
+			
+			submit(call);
+			
+			return static_cast<CallT &>(*call).result();
+		}
+		
+		struct Statistics
+		{
+			std::size_t threads = 0;
+			
+			// The calls which are waiting for a helper thread, and the most which have been waiting at once:
+			std::size_t depth = 0;
+			std::size_t peak_depth = 0;
+			
+			// The calls which are being run by helper threads:
+			std::size_t running = 0;
+			
+			std::size_t submitted = 0;
+			std::size_t completed = 0;
+			
+			// The number of times a caller found the queue full, and had to wait for space:
+			std::size_t full = 0;
+			
+			// The total time calls have spent waiting for a helper thread, and running on one:
+			Timer::Clock::duration waiting = Timer::Clock::duration::zero();
+			Timer::Clock::duration executing = Timer::Clock::duration::zero();
+		};
+		
+		/// A snapshot of the queue depth and timing of the pool, e.g. to choose the number of threads.
+		Statistics statistics() const;
+		
+	private:
+		// A call which is queued. Once it completes, it is posted back to the caller's reactor, if it has one.
+		struct Job : public Link, public Reactor::Task
+		{
+			virtual ~Job() {}
+			
+			// Runs the function on a helper thread, capturing any exception:
+			void (*execute)(Job & job) = nullptr;
+			
+			Fiber * fiber = nullptr;
+			Scheduler * scheduler = nullptr;
+			Reactor * reactor = nullptr;
+			
+			// Held by a scheduled fiber until it has been switched out, so that it can't be made ready while it is still running:
+			Spinlock lock;
+			bool done = false;
+			
+			// Set, under the pool's lock, if the calling fiber was stopped after the call started, in which case whichever of the helper thread or the reactor has the job frees it:
+			bool detached = false;
+			
+			// Whether the job is linked into the backlog rather than the queue, under the pool's lock:
+			bool backlogged = false;
+			
+			std::exception_ptr exception;
+			Timer::Clock::time_point submitted;
+		};
+		
+		template <typename ResultT, typename FunctionT>
+		struct Call : public Job
+		{
+			FunctionT function;
+			typename std::aligned_storage<sizeof(ResultT), alignof(ResultT)>::type storage;
+			bool returned = false;
+			
+			template <typename ArgumentT>
+			Call(ArgumentT && function_) : function(std::forward<ArgumentT>(function_))
+			{
+				this->execute = [](Job & job) {
+					auto & call = static_cast<Call &>(job);
+					
+					new(&call.storage) ResultT(call.function());
+					call.returned = true;
+				};
+			}
+			
+			~Call()
+			{
+				if (returned) reinterpret_cast<ResultT *>(&storage)->~ResultT();
+			}
+			
+			ResultT result()
+			{
+				if (this->exception) std::rethrow_exception(this->exception);
+				
+				return std::move(*reinterpret_cast<ResultT *>(&storage));
+			}
+		};
+		
+		template <typename FunctionT>
+		struct Call<void, FunctionT> : public Job
+		{
+			FunctionT function;
+			
+			template <typename ArgumentT>
+			Call(ArgumentT && function_) : function(std::forward<ArgumentT>(function_))
+			{
+				this->execute = [](Job & job) {
+					static_cast<Call &>(job).function();
+				};
+			}
+			
+			void result()
+			{
+				if (this->exception) std::rethrow_exception(this->exception);
+			}
+		};
+		
+		// Queue the job and suspend the current fiber until it completes. If the fiber is stopped while the job is running, the job is released to be freed once it completes.
+		void submit(std::unique_ptr<Job> & job);
+		
+		// Discard the job if it is still queued, otherwise release it to be freed once it completes.
+		void detach(std::unique_ptr<Job> & job);
+		
+		// Queue the job, or add it to the backlog if the queue is full.
+		void push(Job & job);
+		
+		// Link the job into the queue, with the lock held:
+		void enqueue(Job & job);
+		
+		// Move the oldest call in the backlog into the queue, once there is space, with the lock held:
+		void advance();
+		
+		// Wake the fiber which submitted the job, which must not be used afterwards.
+		static void complete(Job & job);
+		
+		void work();
+		
+		std::size_t _capacity;
+		
+		mutable std::mutex _lock;
+		std::condition_variable _ready;
+		
+		Link _queue;
+		
+		// Calls which found the queue full, and are moved into it as the helper threads take calls:
+		Link _backlog;
+		
+		bool _stopping = false;
+		
+		Statistics _statistics;
+		
+		std::vector<std::thread> _threads;
+	};
+	
+	/// Run a blocking function on the shared pool of helper threads, suspending the current fiber until it returns.
+	template <typename FunctionT>
+	auto blocking(FunctionT && function) -> decltype(Blocking::shared().run(std::forward<FunctionT>(function)))
+	{
+		return Blocking::shared().run(std::forward<FunctionT>(function));
+	}
+#endif
+}
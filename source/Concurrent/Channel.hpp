@@ -0,0 +1,296 @@
+//
+//  Channel.hpp
+//  File file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Waiters.hpp"
+
+#include <memory>
+#include <algorithm>
+#include <type_traits>
+#include <cassert>
+
+namespace Concurrent
+{
+	template <typename Type> class ChannelReceiver;
+	template <typename Type> class ChannelSender;
+	
+	// A bounded queue of values passed between fibers, which may be run by different workers. Senders suspend while the channel is full, and receivers suspend while it is empty, so a slow receiver applies backpressure to its senders. Values are moved into a ring buffer which is allocated once, so sending doesn't allocate. Stackless coroutines can also send and receive, using the awaiters in Async.hpp.
+	template <typename Type>
+	class Channel
+	{
+		typedef typename std::aligned_storage<sizeof(Type), alignof(Type)>::type Storage;
+		
+	public:
+		explicit Channel(std::size_t capacity) : _capacity(capacity), _buffer(new Storage[capacity])
+		{
+			assert(capacity > 0);
+		}
+		
+		~Channel()
+		{
+			while (_size > 0) pop();
+		}
+		
+		Channel(const Channel & other) = delete;
+		Channel & operator=(const Channel & other) = delete;
+		
+		/// Send a value, suspending the current fiber while the channel is full.
+		/// @returns false if the channel was closed, in which case the value was not sent.
+		bool send(Type value)
+		{
+			return send_n(&value, 1) == 1;
+		}
+		
+		/// Send a value if there is space for it.
+		/// @returns false if the channel is full or closed.
+		bool try_send(Type value)
+		{
+			_lock.lock();
+			
+			if (_closed || _size == _capacity) {
+				_lock.unlock();
+				
+				return false;
+			}
+			
+			push(std::move(value));
+			
+			auto receiver = _receivers.pop();
+			_lock.unlock();
+			
+			if (receiver) receiver->schedule();
+			
+			return true;
+		}
+		
+		/// Send the given number of values, moving them from the input range. The current fiber is suspended whenever the channel is full.
+		/// @returns the number of values sent, which is less than count if the channel was closed.
+		template <typename InputIterator>
+		std::size_t send_n(InputIterator first, std::size_t count)
+		{
+			std::size_t sent = 0;
+			
+			while (sent < count) {
+				_lock.lock();
+				
+				while (!_closed && _size == _capacity) {
+					_senders.wait(_lock, [this]{_senders.wake(1, _lock);});
+					_lock.lock();
+				}
+				
+				if (_closed) {
+					_lock.unlock();
+					
+					break;
+				}
+				
+				std::size_t pushed = 0;
+				
+				for (; sent < count && _size < _capacity; ++first, sent += 1, pushed += 1) {
+					push(std::move(*first));
+				}
+				
+				auto waiting = std::min(pushed, _receivers.count());
+				_lock.unlock();
+				
+				_receivers.wake(waiting, _lock);
+			}
+			
+			return sent;
+		}
+		
+		/// Receive a value, suspending the current fiber while the channel is empty.
+		/// @returns false if the channel is closed and all values have been received.
+		bool recv(Type & value)
+		{
+			return recv_n(&value, 1) == 1;
+		}
+		
+		/// Receive a value if one is available.
+		/// @returns false if the channel is empty.
+		bool try_recv(Type & value)
+		{
+			_lock.lock();
+			
+			if (_size == 0) {
+				_lock.unlock();
+				
+				return false;
+			}
+			
+			value = pop();
+			
+			auto sender = _senders.pop();
+			_lock.unlock();
+			
+			if (sender) sender->schedule();
+			
+			return true;
+		}
+		
+		/// Receive up to the given number of values into the output range, suspending the current fiber until at least one is available.
+		/// @returns the number of values received, which is zero if the channel is closed and all values have been received.
+		template <typename OutputIterator>
+		std::size_t recv_n(OutputIterator output, std::size_t count)
+		{
+			if (count == 0) return 0;
+			
+			_lock.lock();
+			
+			while (!_closed && _size == 0) {
+				_receivers.wait(_lock, [this]{_receivers.wake(1, _lock);});
+				_lock.lock();
+			}
+			
+			std::size_t received = 0;
+			
+			for (; received < count && _size > 0; ++output, received += 1) {
+				*output = pop();
+			}
+			
+			auto waiting = std::min(received, _senders.count());
+			_lock.unlock();
+			
+			_senders.wake(waiting, _lock);
+			
+			return received;
+		}
+		
+		/// Prevent any more values from being sent, and wake all waiting fibers. Values which were already sent can still be received.
+		void close()
+		{
+			_lock.lock();
+			
+			_closed = true;
+			
+			auto senders = _senders.count(), receivers = _receivers.count();
+			_lock.unlock();
+			
+			_senders.wake(senders, _lock);
+			_receivers.wake(receivers, _lock);
+		}
+		
+		bool closed() const noexcept
+		{
+			std::lock_guard<Spinlock> lock(_lock);
+			
+			return _closed;
+		}
+		
+		/// The number of values which have been sent but not yet received.
+		std::size_t size() const noexcept
+		{
+			std::lock_guard<Spinlock> lock(_lock);
+			
+			return _size;
+		}
+		
+		std::size_t capacity() const noexcept {return _capacity;}
+		
+	private:
+		Type * slot(std::size_t index) noexcept
+		{
+			return reinterpret_cast<Type *>(&_buffer[index % _capacity]);
+		}
+		
+		// With the lock held, and space available:
+		void push(Type && value)
+		{
+			new(slot(_head + _size)) Type(std::move(value));
+			_size += 1;
+		}
+		
+		// Receive a value on behalf of a waiter which isn't a fiber, e.g. an awaiting coroutine, passing it to the given function with the lock held. If the channel is empty and still open, the waiter is added to the receivers instead, and tries again once it is woken.
+		// @returns false if the waiter was added.
+		template <typename ReceiveT>
+		bool recv_or_wait(Waiters::Waiter & waiter, ReceiveT && receive)
+		{
+			_lock.lock();
+			
+			if (!_closed && _size == 0) {
+				_receivers.push(waiter);
+				_lock.unlock();
+				
+				return false;
+			}
+			
+			Waiters::Waiter * sender = nullptr;
+			
+			if (_size > 0) {
+				receive(pop());
+				sender = _senders.pop();
+			}
+			
+			_lock.unlock();
+			
+			if (sender) sender->schedule();
+			
+			return true;
+		}
+		
+		// Send a value on behalf of a waiter which isn't a fiber. If the channel is full and still open, the waiter is added to the senders instead, and tries again once it is woken.
+		// @returns false if the waiter was added, otherwise whether the value was sent is stored in sent.
+		bool send_or_wait(Waiters::Waiter & waiter, Type & value, bool & sent)
+		{
+			_lock.lock();
+			
+			if (!_closed && _size == _capacity) {
+				_senders.push(waiter);
+				_lock.unlock();
+				
+				return false;
+			}
+			
+			Waiters::Waiter * receiver = nullptr;
+			sent = !_closed;
+			
+			if (sent) {
+				push(std::move(value));
+				receiver = _receivers.pop();
+			}
+			
+			_lock.unlock();
+			
+			if (receiver) receiver->schedule();
+			
+			return true;
+		}
+		
+		// With the lock held, and a value available:
+		Type pop()
+		{
+			auto item = slot(_head);
+			
+			Type value(std::move(*item));
+			item->~Type();
+			
+			_head = (_head + 1) % _capacity;
+			_size -= 1;
+			
+			return value;
+		}
+		
+		mutable Spinlock _lock;
+		
+		std::size_t _capacity;
+		std::unique_ptr<Storage[]> _buffer;
+		
+		// The index of the oldest value, and the number of values:
+		std::size_t _head = 0;
+		std::size_t _size = 0;
+		
+		bool _closed = false;
+		
+		Waiters _senders;
+		Waiters _receivers;
+		
+		friend class ChannelReceiver<Type>;
+		friend class ChannelSender<Type>;
+	};
+}
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <memory>
+#include <type_traits>
 #include "Stack.hpp"
 
 #include <Coroutine/Context.h>
@@ -20,18 +21,19 @@ namespace Concurrent
 		FunctionT function;
 		
 		static COROUTINE cocall(CoroutineContext * from, CoroutineContext * self);
-		Coentry(FunctionT && function_) : function(std::move(function_)) {}
+		Coentry(FunctionT function_) : function(std::move(function_)) {}
 	};
 	
+	// The function is stored by value, so that it outlives the expression which created the fiber.
 	template <typename FunctionT>
-	Coentry<FunctionT> make_coentry(FunctionT && function)
+	Coentry<typename std::decay<FunctionT>::type> make_coentry(FunctionT && function)
 	{
-		return Coentry<FunctionT>(std::move(function));
+		return Coentry<typename std::decay<FunctionT>::type>(std::forward<FunctionT>(function));
 	}
 	
 	template <typename FunctionT>
-	Coentry<FunctionT> * emplace_coentry(Stack & stack, FunctionT && function)
+	Coentry<typename std::decay<FunctionT>::type> * emplace_coentry(Stack & stack, FunctionT && function)
 	{
-		return stack.emplace<Coentry<FunctionT>>(std::move(function));
+		return stack.emplace<Coentry<typename std::decay<FunctionT>::type>>(std::forward<FunctionT>(function));
 	}
 }
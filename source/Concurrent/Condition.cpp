@@ -9,8 +9,11 @@
 #include "Condition.hpp"
 
 #include "Fiber.hpp"
+#include "Scheduler.hpp"
+#include "Trace.hpp"
 
 #include <iostream>
+#include <cassert>
 
 namespace Concurrent
 {
@@ -20,32 +23,181 @@ namespace Concurrent
 	
 	Condition::~Condition()
 	{
-		// std::cerr << "Condition@" << this << "::~Condition _waiting=" << _waiting.size() << " _current=" << Fiber::current << std::endl;
-		while (!_waiting.empty()) {
-			auto fiber = _waiting.back();
-			_waiting.pop_back();
-
-			if (fiber)
+		// std::cerr << "Condition@" << this << "::~Condition _count=" << _count << " _current=" << Fiber::current << std::endl;
+		while (auto node = pop()) {
+			auto fiber = node->fiber;
+			
+			if (!fiber) {
+				node->wake(*node, true);
+			} else if (auto scheduler = fiber->scheduler()) {
+				fiber->cancel();
+				scheduler->schedule(fiber);
+			} else {
 				fiber->stop();
+			}
 		}
 	}
 	
-	void Condition::wait()
+	Condition::Node * Condition::pop()
+	{
+		std::lock_guard<Spinlock> lock(_lock);
+		
+		if (_waiting.empty()) return nullptr;
+		
+		auto node = static_cast<Node *>(_waiting.next);
+		node->unlink();
+		_count -= 1;
+		
+		if (node->fiber && node->fiber->_scheduler) node->fiber->unpark();
+		
+		return node;
+	}
+	
+	void Condition::wake(Node & node)
+	{
+		if (node.fiber) {
+			node.fiber->schedule();
+		} else {
+			node.wake(node, false);
+		}
+	}
+	
+	void Condition::push(Node & node)
+	{
+		std::lock_guard<Spinlock> lock(_lock);
+		
+		assert(!node.linked());
+		_waiting.push_back(node);
+		_count += 1;
+	}
+	
+	bool Condition::remove(Node & node) noexcept
+	{
+		std::lock_guard<Spinlock> lock(_lock);
+		
+		if (!node.linked()) return false;
+		
+		node.unlink();
+		_count -= 1;
+		
+		return true;
+	}
+	
+	bool Condition::wait()
 	{
 		// std::cerr << "Condition@" << this << "::wait _current=" << Fiber::current << std::endl;
 
-		_waiting.push_back(Fiber::current);
-		Fiber::current->yield();
+		auto fiber = Fiber::current;
+		
+		if (fiber->stop_requested()) return false;
+		
+		Trace::hook(Trace::Type::WAIT, fiber, this);
+		
+		// If the fiber is resumed by anything other than this condition, e.g. it is stopped, it must not be left in the list. Otherwise it was unlinked before being woken, and the condition may no longer exist:
+		struct Unlink {
+			Condition & condition;
+			Node & node;
+			
+			~Unlink()
+			{
+				if (node.linked()) {
+					std::lock_guard<Spinlock> lock(condition._lock);
+					
+					node.unlink();
+					condition._count -= 1;
+				}
+			}
+		} unlink{*this, fiber->_waiter};
+		
+		_lock.lock();
+		
+		assert(!fiber->_waiter.linked());
+		_waiting.push_back(fiber->_waiter);
+		_count += 1;
+		
+		if (fiber->scheduler()) {
+			// Once parked, request_stop can remove the fiber from the list and make it ready, from any thread:
+			Fiber::Parking parking{&_lock, &fiber->_waiter, &_count};
+			
+			if (!fiber->park(parking)) {
+				_lock.unlock();
+				
+				return false;
+			}
+			
+			// The lock is released after the fiber has been switched out, otherwise another worker could resume it while it is still running:
+			Scheduler::suspend(_lock);
+		} else {
+			_lock.unlock();
+			fiber->yield();
+		}
+		
+		return !fiber->stop_requested();
+	}
+	
+	// Removes the fiber from the condition and resumes it, if it is still waiting when the timer expires.
+	class Condition::Timeout : public Timer
+	{
+	public:
+		Timeout(Condition & condition, Fiber * fiber) : _condition(condition), _fiber(fiber) {}
+		
+		bool expired = false;
+		
+	protected:
+		void expire() override
+		{
+			{
+				std::lock_guard<Spinlock> lock(_condition._lock);
+				
+				if (!_fiber->_waiter.linked()) return;
+				
+				_fiber->_waiter.unlink();
+				_condition._count -= 1;
+			}
+			
+			expired = true;
+			_fiber->schedule();
+		}
+		
+	private:
+		Condition & _condition;
+		Fiber * _fiber;
+	};
+	
+	bool Condition::wait_for(Timer::Clock::duration timeout)
+	{
+		auto fiber = Fiber::current;
+		
+		// The timer must be cancelled by the thread which inserted it:
+		assert(fiber->scheduler() == nullptr);
+		
+		Timeout timer(*this, fiber);
+		Timer::Wheel::local().insert(timer, timeout);
+		
+		return wait() && !timer.expired;
+	}
+	
+	bool Condition::signal()
+	{
+		auto node = pop();
+		
+		if (!node) return false;
+		
+		Trace::hook(Trace::Type::SIGNAL, node->fiber, this);
+		
+		wake(*node);
+		
+		return true;
 	}
 	
 	void Condition::resume()
 	{
-		while (!_waiting.empty()) {
-			auto fiber = _waiting.back();
-			_waiting.pop_back();
-
-			if (fiber->status() != Status::FINISHED)
-				fiber->resume();
+		// Only fibers which are waiting now are woken, as they may wait again once woken. If a fiber throws, the rest are still waiting:
+		std::size_t count = this->count();
+		
+		if (count > 0) Trace::hook(Trace::Type::BROADCAST, Fiber::current, this);
+		
+		while (count-- && signal()) {
 		}
 	}
 }
@@ -8,13 +8,17 @@
 
 #pragma once
 
-#include <vector>
+#include "Spinlock.hpp"
+#include "Timer.hpp"
+#include "Link.hpp"
+
+#include <mutex>
 
 namespace Concurrent
 {
 	class Fiber;
 	
-	// A synchronization primative, which allows fibers to wait until a particular condition is triggered.
+	// A synchronization primative, which allows fibers to wait until a particular condition is triggered. Fibers run by a Scheduler are made ready rather than being resumed directly, so a condition can be shared between workers. Waiting fibers are linked into an intrusive list, so waiting never allocates, and are woken in the order they started waiting.
 	class Condition
 	{
 	public:
@@ -26,12 +30,60 @@ namespace Concurrent
 		Condition(const Condition & other) = delete;
 		Condition & operator=(const Condition & other) = delete;
 		
-		void wait();
+		// A fiber or stackless coroutine waiting on a condition. Each fiber has its own, while awaiters embed one in the coroutine's frame.
+		struct Node : public Link
+		{
+			Node(Fiber * fiber_) noexcept : fiber(fiber_) {}
+			
+			// The waiting fiber, which is scheduled when it is woken, if any:
+			Fiber * fiber = nullptr;
+			
+			// Otherwise, invoked to wake the waiter once it has been removed. If the condition is being destroyed, stopped is true:
+			void (*wake)(Node & node, bool stopped) = nullptr;
+		};
+		
+		/// Suspend the current fiber until it is signalled or the condition is resumed.
+		/// @returns false if the fiber has been asked to stop, in which case it may not have waited.
+		bool wait();
+		
+		/// Wait until the condition is resumed, or the timeout passes, using the timer wheel of the current thread. This is not supported for fibers run by a Scheduler, as they may be resumed on a different thread.
+		/// @returns false if the wait timed out, or the fiber has been asked to stop.
+		bool wait_for(Timer::Clock::duration timeout);
+		
+		/// Wake the fiber which has been waiting the longest.
+		/// @returns false if there were no waiting fibers.
+		bool signal();
+		
+		/// Wake all fibers which are waiting, in the order they started waiting. Fibers which wait again once woken are not woken a second time.
 		void resume();
 		
-		std::size_t count() const noexcept {return _waiting.size();}
+		/// Add a waiter which isn't a fiber, e.g. an awaiting coroutine, to the back of the list. It is removed from the list before it is woken.
+		void push(Node & node);
+		
+		/// Remove a waiter which was added by push, e.g. because its coroutine was destroyed.
+		/// @returns whether the waiter was still waiting.
+		bool remove(Node & node) noexcept;
+		
+		std::size_t count() const noexcept
+		{
+			std::lock_guard<Spinlock> lock(_lock);
+			
+			return _count;
+		}
 		
 	private:
-		std::vector<Fiber *> _waiting;
+		class Timeout;
+		
+		// Remove the waiter which has been waiting the longest, if any.
+		Node * pop();
+		
+		// Wake a waiter which has been removed from the list.
+		static void wake(Node & node);
+		
+		mutable Spinlock _lock;
+		
+		// The sentinel of the list of waiters, and its length:
+		Link _waiting;
+		std::size_t _count = 0;
 	};
 }
@@ -0,0 +1,152 @@
+//
+//  Deque.hpp
+//  File file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include <type_traits>
+
+namespace Concurrent
+{
+	// A Chase-Lev work-stealing deque. The owning thread pushes and pops items at the bottom, while any other thread can steal items from the top. Based on "Correct and Efficient Work-Stealing for Weak Memory Models" by Lê, Pop, Cohen and Zappa Nardelli.
+	template <typename Type>
+	class Deque
+	{
+		static_assert(std::is_trivially_copyable<Type>::value, "Deque items must be trivially copyable!");
+		
+		typedef std::int64_t Index;
+		
+		class Array
+		{
+		public:
+			Array(std::size_t capacity) : _mask(capacity - 1), _items(new std::atomic<Type>[capacity]) {}
+			
+			std::size_t capacity() const noexcept {return _mask + 1;}
+			
+			Type get(Index index) const noexcept {return _items[index & _mask].load(std::memory_order_relaxed);}
+			void put(Index index, Type item) noexcept {_items[index & _mask].store(item, std::memory_order_relaxed);}
+			
+			Array * grow(Index bottom, Index top) const
+			{
+				auto array = new Array(capacity() * 2);
+				
+				for (Index index = top; index < bottom; index += 1) {
+					array->put(index, get(index));
+				}
+				
+				return array;
+			}
+			
+		private:
+			std::size_t _mask;
+			std::unique_ptr<std::atomic<Type>[]> _items;
+		};
+		
+	public:
+		// The capacity must be a power of two.
+		Deque(std::size_t capacity = 64) : _array(new Array(capacity))
+		{
+		}
+		
+		~Deque()
+		{
+			delete _array.load(std::memory_order_relaxed);
+		}
+		
+		Deque(const Deque & other) = delete;
+		Deque & operator=(const Deque & other) = delete;
+		
+		// Push an item onto the bottom of the deque. Only the owning thread may call this.
+		void push(Type item)
+		{
+			auto bottom = _bottom.load(std::memory_order_relaxed);
+			auto top = _top.load(std::memory_order_acquire);
+			auto array = _array.load(std::memory_order_relaxed);
+			
+			if (bottom - top > Index(array->capacity()) - 1) {
+				// Thieves may still be reading from the previous array, so it is retired rather than deleted:
+				_retired.emplace_back(array);
+				array = array->grow(bottom, top);
+				_array.store(array, std::memory_order_release);
+			}
+			
+			array->put(bottom, item);
+			
+			std::atomic_thread_fence(std::memory_order_release);
+			_bottom.store(bottom + 1, std::memory_order_relaxed);
+		}
+		
+		// Pop an item from the bottom of the deque. Only the owning thread may call this.
+		bool pop(Type & item)
+		{
+			auto bottom = _bottom.load(std::memory_order_relaxed) - 1;
+			auto array = _array.load(std::memory_order_relaxed);
+			
+			_bottom.store(bottom, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			
+			auto top = _top.load(std::memory_order_relaxed);
+			
+			if (top <= bottom) {
+				item = array->get(bottom);
+				
+				if (top == bottom) {
+					// This is the last item, so we race against any thieves for it:
+					bool won = _top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+					_bottom.store(bottom + 1, std::memory_order_relaxed);
+					
+					return won;
+				}
+				
+				return true;
+			} else {
+				_bottom.store(bottom + 1, std::memory_order_relaxed);
+				
+				return false;
+			}
+		}
+		
+		// Steal an item from the top of the deque. Any thread may call this.
+		bool steal(Type & item)
+		{
+			auto top = _top.load(std::memory_order_acquire);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			auto bottom = _bottom.load(std::memory_order_acquire);
+			
+			if (top < bottom) {
+				auto array = _array.load(std::memory_order_acquire);
+				item = array->get(top);
+				
+				return _top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+			}
+			
+			return false;
+		}
+		
+		// An approximation of the number of items, which is only exact when called by the owning thread.
+		std::size_t size() const noexcept
+		{
+			auto bottom = _bottom.load(std::memory_order_relaxed);
+			auto top = _top.load(std::memory_order_relaxed);
+			
+			return bottom > top ? bottom - top : 0;
+		}
+		
+		bool empty() const noexcept {return size() == 0;}
+		
+	private:
+		std::atomic<Index> _top{0};
+		std::atomic<Index> _bottom{0};
+		std::atomic<Array *> _array;
+		
+		std::vector<std::unique_ptr<Array>> _retired;
+	};
+}
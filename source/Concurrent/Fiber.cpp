@@ -7,9 +7,13 @@
 //
 
 #include "Fiber.hpp"
+#include "Scheduler.hpp"
+#include "Sizing.hpp"
+#include "Trace.hpp"
 
 #include <stdexcept>
 #include <iostream>
+#include <cstring>
 #include <cassert>
 
 #if defined(CONCURRENT_SANITIZE_ADDRESS)
@@ -21,20 +25,65 @@ namespace Concurrent
 	thread_local Fiber Fiber::main;
 	thread_local Fiber * Fiber::current = &Fiber::main;
 	thread_local std::size_t Fiber::level = 0;
+	thread_local std::atomic<Fiber *> Fiber::active{nullptr};
 	
-	Fiber::Fiber() noexcept : _status(Status::MAIN), _annotation("main")
+	constexpr std::size_t Fiber::DEFAULT_STACK_SIZE;
+	constexpr std::size_t Fiber::ANNOTATION_SIZE;
+	constexpr std::chrono::milliseconds Fiber::DEFAULT_BUDGET;
+	constexpr std::size_t Fiber::Pool::DEFAULT_MAXIMUM_STACKS;
+	
+	Fiber::Fiber() noexcept : _status(Status::MAIN)
 	{
+		annotate("main");
 	}
 	
 	Fiber::~Fiber()
 	{
 		// std::cerr << std::string(Fiber::level, '\t') << "-> ~Fiber " << _annotation << " with status " << (int)_status << std::endl;
 
+		finalize();
+		
+		// The registration is declared before the stack, so it would only be removed once the stack has been released:
+		_registration.unregister();
+		
+		// A fiber which is destroyed while it is ready must not be resumed by the loop:
+		_node.unlink();
+		
+		// std::cerr << std::string(Fiber::level, '\t') << "<- ~Fiber " << _annotation << std::endl;
+	}
+	
+	Stack Fiber::destroy(Fiber * fiber)
+	{
+		// Stopping the fiber runs it on the stack, so the stack can only be taken once it has finished:
+		fiber->finalize();
+		
+		// Snapshots of the registry read the fiber's stack, so it must be removed before the stack is taken:
+		fiber->_registration.unregister();
+		
+		Stack stack(std::move(fiber->_stack));
+		fiber->~Fiber();
+		
+		return stack;
+	}
+	
+	void Fiber::annotate(const char * annotation) noexcept
+	{
+		if (annotation == nullptr) annotation = "";
+		
+		std::strncpy(_annotation, annotation, ANNOTATION_SIZE - 1);
+		_annotation[ANNOTATION_SIZE - 1] = '\0';
+	}
+	
+	void Fiber::finalize()
+	{
 		if (_status == Status::READY) {
 			// Nothing to do here.
 		} else if (_status == Status::RUNNING) {
 			// Force fiber to stop.
 			stop();
+			
+			// A fiber which suspends again rather than unwinding, e.g. until the kernel has finished with its buffers, can't be released:
+			if (_status != Status::FINISHED) std::terminate();
 		} else if (_status == Status::FINISHING) {
 			// Still cleaning up...
 			resume();
@@ -48,9 +97,9 @@ namespace Concurrent
 			catch (const std::exception & exception) {
 				std::cerr << "Fiber '" << _annotation << "' exiting with unhandled exception: " << exception.what() << std::endl;
 			}
+			
+			_exception = nullptr;
 		}
-		
-		// std::cerr << std::string(Fiber::level, '\t') << "<- ~Fiber " << _annotation << std::endl;
 	}
 	
 #if defined(CONCURRENT_SANITIZE_ADDRESS)
@@ -88,9 +137,18 @@ namespace Concurrent
 
 		assert(_status != Status::FINISHED);
 
+		// If the fiber is resumed directly, e.g. to stop it, it is no longer ready:
+		if (_node.linked()) _node.unlink();
+		
 		Fiber::current = this;
+		Fiber::active.store(this, std::memory_order_relaxed);
+		Watchdog::Slice::switched(this);
+		_resumed = true;
 		// std::cerr << std::string(Fiber::level, '\t') << _caller->_annotation << " resuming " << _annotation << std::endl;
 
+		Trace::hook(Trace::Type::RESUME, this);
+		Registry::Node::switched(_caller->_registration, _registration);
+		
 		Fiber::level += 1;
 
 #if defined(CONCURRENT_SANITIZE_ADDRESS)
@@ -109,9 +167,26 @@ namespace Concurrent
 		// std::cerr << std::string(Fiber::level, '\t') << "resume back in " << _caller->_annotation << std::endl;
 
 		Fiber::current = _caller;
+		Fiber::active.store(_caller, std::memory_order_relaxed);
+		Watchdog::Slice::switched(_caller);
 
 		this->_caller = nullptr;
 
+		// A fiber which is migrating may be resumed by another thread as soon as it has been handed off, and a task's fiber may be destroyed once it has exited, so it can't be used afterwards:
+		if (_handoff) {
+			auto handoff = _handoff;
+			_handoff = nullptr;
+			
+#if defined(CONCURRENT_SANITIZE_ADDRESS)
+			// The fake stack belongs to this thread, and is replaced when the fiber is next resumed:
+			_fake_stack = nullptr;
+#endif
+			
+			handoff->invoke(*handoff, *this);
+			
+			return;
+		}
+		
 		// Once we yield back to the caller, if there was an exception, we rethrow it.
 		if (_exception) {
 			// Get a copy of the exception pointer:
@@ -125,12 +200,15 @@ namespace Concurrent
 		}
 	}
 
-	void Fiber::yield()
+	bool Fiber::yield()
 	{
 		assert(_caller != nullptr);
 
 		// std::cerr << std::string(Fiber::level, '\t') << _annotation << " yielding to " << _caller->_annotation << std::endl;
 
+		Trace::hook(Trace::Type::YIELD, this);
+		Registry::Node::switched(_registration, _caller->_registration);
+		
 #if defined(CONCURRENT_SANITIZE_ADDRESS)
 		start_pop_stack("yield");
 #endif
@@ -146,8 +224,32 @@ namespace Concurrent
 		if (_status == Status::STOPPED) {
 			throw Stop();
 		}
+		
+		return !stop_requested();
 	}
 
+	bool Fiber::migrate(Handoff & handoff)
+	{
+		assert(Fiber::current == this);
+		assert(_scheduler == nullptr);
+		
+		_handoff = &handoff;
+		
+		return yield();
+	}
+	
+	bool Fiber::pass()
+	{
+		if (_scheduler) return Scheduler::yield();
+		
+		// A fiber which was transferred to has no caller to yield to:
+		if (_caller == nullptr) return !stop_requested();
+		
+		if (auto loop = Loop::current()) loop->push(this);
+		
+		return yield();
+	}
+	
 	void Fiber::transfer()
 	{
 		// Transferring to ourselves is a no-op.
@@ -162,10 +264,18 @@ namespace Concurrent
 #endif
 
 		Fiber::current = this;
+		Fiber::active.store(this, std::memory_order_relaxed);
+		Watchdog::Slice::switched(this);
+		_resumed = true;
 
+		Trace::hook(Trace::Type::TRANSFER, this);
+		Registry::Node::switched(current->_registration, _registration);
+		
 		coroutine_transfer(&current->_context, &_context);
 
 		Fiber::current = current;
+		Fiber::active.store(current, std::memory_order_relaxed);
+		Watchdog::Slice::switched(current);
 
 #if defined(CONCURRENT_SANITIZE_ADDRESS)
 		finish_pop_stack("transfer");
@@ -191,6 +301,9 @@ namespace Concurrent
 
 		// std::cerr << std::string(Fiber::level, '\t') << _annotation << " terminating to " << caller->_annotation << std::endl;
 
+		Trace::hook(Trace::Type::RETURN, this);
+		Registry::Node::switched(_registration, caller->_registration);
+		
 #if defined(CONCURRENT_SANITIZE_ADDRESS)
 		start_pop_stack("coreturn", true);
 #endif
@@ -200,12 +313,131 @@ namespace Concurrent
 		std::terminate();
 	}
 	
-	void Fiber::wait()
+	bool Fiber::wait()
 	{
 		// Cannot wait for own self to complete.
 		assert(Fiber::current != this);
 		
-		_completion.wait();
+		// The completion is resumed once, when the fiber starts finishing:
+		while (_status != Status::FINISHING && _status != Status::FINISHED) {
+			if (!_completion.wait()) return false;
+		}
+		
+		return true;
+	}
+	
+	void Fiber::schedule()
+	{
+		if (_scheduler) {
+			_scheduler->schedule(this);
+		} else if (_status != Status::FINISHED) {
+			if (auto loop = Loop::current()) {
+				loop->push(this);
+			} else {
+				resume();
+			}
+		}
+	}
+	
+	namespace
+	{
+		// Schedules a sleeping fiber when the timer expires.
+		class Wakeup : public Timer
+		{
+		public:
+			Wakeup(Fiber * fiber) : _fiber(fiber) {}
+			
+		protected:
+			void expire() override
+			{
+				_fiber->schedule();
+			}
+			
+		private:
+			Fiber * _fiber;
+		};
+	}
+	
+	bool Fiber::sleep(Timer::Clock::duration duration)
+	{
+		auto fiber = Fiber::current;
+		
+		if (fiber->stop_requested()) return false;
+		
+		// The wheel is only updated by this thread once the fiber has yielded, so there is no race with the timer expiring. If the fiber is woken early, the timer is cancelled when it goes out of scope:
+		Wakeup wakeup(fiber);
+		Timer::Wheel::local().insert(wakeup, duration);
+		
+		return fiber->yield();
+	}
+	
+	std::size_t Fiber::trim()
+	{
+		// The stack pointer is only saved while the fiber is suspended, and the main fiber doesn't have a stack of its own:
+		if (Fiber::current == this || _status == Status::MAIN || _status == Status::FINISHED) return 0;
+		
+		return _stack.trim(_context.stack_pointer);
+	}
+	
+	bool Fiber::park(Parking & parking) noexcept
+	{
+		std::lock_guard<Spinlock> guard(_parking_lock);
+		
+		// Either request_stop set the flag before we took the lock, or it will find the registration once we release it:
+		if (stop_requested()) return false;
+		
+		_parking = &parking;
+		
+		return true;
+	}
+	
+	void Fiber::unpark() noexcept
+	{
+		std::lock_guard<Spinlock> guard(_parking_lock);
+		
+		_parking = nullptr;
+	}
+	
+	void Fiber::request_stop()
+	{
+		_stop_requested.store(true, std::memory_order_relaxed);
+		
+		if (_scheduler) {
+			// The primitive's lock is taken out of order, so it can only be tried. Whoever holds it may be removing the fiber, in which case the registration is cleared once they are done:
+			while (true) {
+				_parking_lock.lock();
+				
+				auto parking = _parking;
+				
+				if (parking == nullptr) {
+					_parking_lock.unlock();
+					
+					return;
+				}
+				
+				if (parking->lock->try_lock()) {
+					parking->node->unlink();
+					*parking->count -= 1;
+					_parking = nullptr;
+					
+					// The lock is only released once the fiber has been switched out, so it can be made ready:
+					parking->lock->unlock();
+					_parking_lock.unlock();
+					
+					_scheduler->schedule(this);
+					
+					return;
+				}
+				
+				_parking_lock.unlock();
+				Spinlock::relax();
+			}
+		}
+		
+		// A fiber which has yielded has no caller. Otherwise it is running, or has resumed another fiber, and will see the request at its next suspend point:
+		if (_scheduler == nullptr && _caller == nullptr && _status == Status::RUNNING && Fiber::current != this) {
+			schedule();
+		}
 	}
 	
 	void Fiber::stop()
@@ -229,16 +461,119 @@ namespace Concurrent
 		this->stack_pointer = nullptr;
 	}
 	
-	Fiber::Pool::Pool(std::size_t stack_size) : _stack_size(stack_size)
+	Fiber::Pool::Pool(std::size_t stack_size, std::size_t maximum_stacks, bool release_stacks, const Stack::Options & options) : _stack_size(stack_size), _options(options), _maximum_stacks(maximum_stacks), _release_stacks(release_stacks)
 	{
+		_stacks.reserve(_maximum_stacks);
+	}
+	
+	Fiber::Pool::Pool(Stack::Arena & arena, std::size_t maximum_stacks, bool release_stacks) : _stack_size(arena.stack_size()), _arena(&arena), _maximum_stacks(maximum_stacks), _release_stacks(release_stacks)
+	{
+		_stacks.reserve(_maximum_stacks);
 	}
 	
 	Fiber::Pool::~Pool()
 	{
-		// std::cerr << "Fiber pool going out of scope with " << _fibers.size() << " fibers allocated" << std::endl;
-		// 
-		// for (auto && fiber : _fibers) {
-		// 	std::cerr << "\tFiber " << &fiber << " stack " << fiber.stack().top() << ": " << fiber.annotation() << " (" << (std::size_t)(fiber.status()) << ")" << std::endl;
-		// }
+		// std::cerr << "Fiber pool going out of scope with " << _count << " fibers allocated" << std::endl;
+		
+		// Destroying a suspended fiber stops it, which may finish other fibers, but they stay in the list until they are destroyed:
+		while (!_fibers.empty()) {
+			auto member = static_cast<Member *>(_fibers.next);
+			member->unlink();
+			
+			Fiber::destroy(member->fiber);
+		}
+	}
+	
+	void Fiber::Pool::request_stop()
+	{
+		for (auto link = _fibers.next; link != &_fibers; ) {
+			auto fiber = static_cast<Member *>(link)->fiber;
+			
+			// The fiber may finish, but it isn't unlinked until it is reaped:
+			link = link->next;
+			
+			fiber->request_stop();
+		}
+	}
+	
+	void Fiber::Pool::reap()
+	{
+		std::size_t pending = 0;
+		
+		for (auto member : _finished) {
+			auto fiber = member->fiber;
+			
+			// A fiber which is still notifying its waiters can't be reaped yet:
+			if (fiber->_status == Status::FINISHED) {
+				if (_sizing) _sizing->record(*fiber);
+				
+				member->unlink();
+				_count -= 1;
+				
+				release(Fiber::destroy(fiber));
+			} else {
+				_finished[pending++] = member;
+			}
+		}
+		
+		_finished.resize(pending);
+	}
+	
+	std::size_t Fiber::Pool::trim(Timer::Clock::duration idle)
+	{
+		auto now = Timer::Clock::now();
+		
+		if (now - _checked < idle) return 0;
+		
+		_checked = now;
+		
+		std::size_t trimmed = 0;
+		
+		for (auto link = _fibers.next; link != &_fibers; link = link->next) {
+			auto & fiber = *static_cast<Member *>(link)->fiber;
+			
+			if (fiber._resumed) {
+				// The fiber has run since the last check, so it is only idle if it doesn't run again before the next one:
+				fiber._resumed = false;
+				fiber._trimmed = false;
+			} else if (!fiber._trimmed) {
+				trimmed += fiber.trim();
+				fiber._trimmed = true;
+			}
+		}
+		
+		return trimmed;
+	}
+	
+	Stack Fiber::Pool::acquire()
+	{
+		if (_stacks.empty()) {
+			if (_arena) return _arena->allocate();
+			
+			return Stack(_stack_size, _options);
+		}
+		
+		// The most recently used stack is the most likely to still be resident:
+		Stack stack(std::move(_stacks.back()));
+		_stacks.pop_back();
+		
+		return stack;
+	}
+	
+	void Fiber::Pool::release(Stack && stack)
+	{
+		if (_stacks.size() < _maximum_stacks) {
+			stack.reset();
+			
+			if (_sizing) {
+				stack.discard();
+			} else if (_release_stacks) {
+				stack.release();
+			}
+			
+			_stacks.push_back(std::move(stack));
+		}
+		
+		// Otherwise, the stack goes out of scope and is unmapped.
 	}
 }
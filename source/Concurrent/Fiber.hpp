@@ -16,17 +16,16 @@
 #include "Stack.hpp"
 #include "Condition.hpp"
 #include "Coentry.hpp"
+#include "Timer.hpp"
+#include "Link.hpp"
+#include "Loop.hpp"
+#include "Registry.hpp"
+#include "Watchdog.hpp"
 
 #include <string>
-#include <list>
-
-#if defined(__SANITIZE_ADDRESS__)
-	#define CONCURRENT_SANITIZE_ADDRESS
-#elif defined(__has_feature)
-	#if __has_feature(address_sanitizer)
-		#define CONCURRENT_SANITIZE_ADDRESS
-	#endif
-#endif
+#include <vector>
+#include <atomic>
+#include <cassert>
 
 namespace Concurrent
 {
@@ -42,6 +41,9 @@ namespace Concurrent
 	
 	class Stop {};
 	
+	class Scheduler;
+	class Sizing;
+	
 	class Fiber
 	{
 	public:
@@ -49,21 +51,61 @@ namespace Concurrent
 		thread_local static Fiber * current;
 		thread_local static std::size_t level;
 		
+		// The same fiber as current, but constant initialized, so that signal handlers can read it without initializing the thread's main fiber. It is null until the thread first switches fibers.
+		thread_local static std::atomic<Fiber *> active;
+		
 		bool transient = false;
 		
-		// TODO assess how much of a performance impact this has in the presence of virtual memory. Can it be bigger? Should it be smaller?
+		// Only the pages which are touched are committed, so a large stack mostly costs address space and the time to map it. The Concurrent::Fiber and Concurrent::Stack benchmarks measure this for several sizes.
 		static constexpr std::size_t DEFAULT_STACK_SIZE = 1024*1024*4;
 		
+		// Annotations are copied into a buffer in the fiber, so that annotating a fiber doesn't allocate. Longer annotations are truncated.
+		static constexpr std::size_t ANNOTATION_SIZE = 32;
+		
+		// The longest a fiber runs before maybe_yield gives the other fibers of its thread a turn.
+		static constexpr std::chrono::milliseconds DEFAULT_BUDGET{10};
+		
+		template <typename FunctionT>
+		Fiber(FunctionT && function, std::size_t stack_size = DEFAULT_STACK_SIZE, const Stack::Options & options = Stack::Options()) : _stack(stack_size, options), _context(_stack, std::forward<FunctionT>(function))
+		{
+		}
+		
+		template <typename FunctionT>
+		Fiber(const char * annotation, FunctionT && function, std::size_t stack_size = DEFAULT_STACK_SIZE, const Stack::Options & options = Stack::Options()) : _stack(stack_size, options), _context(_stack, std::forward<FunctionT>(function))
+		{
+			annotate(annotation);
+		}
+		
+		/// Construct a fiber using an existing stack, e.g. one recycled from a finished fiber.
+		template <typename FunctionT>
+		Fiber(Stack && stack, FunctionT && function) : _stack(std::move(stack)), _context(_stack, std::forward<FunctionT>(function))
+		{
+		}
+		
+		template <typename FunctionT>
+		Fiber(const char * annotation, Stack && stack, FunctionT && function) : _stack(std::move(stack)), _context(_stack, std::forward<FunctionT>(function))
+		{
+			annotate(annotation);
+		}
+		
+		/// Construct a fiber at the top of its own stack, above its function, so that the fiber costs a single stack and no heap allocations. The fiber must be destroyed using Fiber::destroy.
 		template <typename FunctionT>
-		Fiber(FunctionT && function, std::size_t stack_size = DEFAULT_STACK_SIZE) : _stack(stack_size), _context(_stack, function)
+		static Fiber * emplace(Stack && stack, FunctionT && function)
 		{
+			return emplace(nullptr, std::move(stack), std::forward<FunctionT>(function));
 		}
 		
 		template <typename FunctionT>
-		Fiber(std::string annotation, FunctionT && function, std::size_t stack_size = DEFAULT_STACK_SIZE) : _annotation(annotation), _stack(stack_size), _context(_stack, function)
+		static Fiber * emplace(const char * annotation, Stack && stack, FunctionT && function)
 		{
+			// The space for the fiber is reserved before it is constructed, and the fiber then takes the stack, including that reservation:
+			return stack.emplace<Fiber>(annotation, std::move(stack), std::forward<FunctionT>(function));
 		}
 		
+		/// Destroy a fiber which was constructed by Fiber::emplace, stopping it if it hasn't finished.
+		/// @returns the stack which the fiber occupied, so that it can be reused.
+		static Stack destroy(Fiber * fiber);
+		
 		~Fiber();
 		
 		Fiber(const Fiber & other) = delete;
@@ -76,11 +118,23 @@ namespace Concurrent
 		void resume();
 		
 		/// Yield back to the caller.
-		void yield();
+		/// @returns false if the fiber has been asked to stop.
+		bool yield();
 
 		/// Transfer control to this fiber.
 		void transfer();
 
+		// Invoked once a fiber has been switched out, e.g. to hand a migrating fiber to another thread.
+		struct Handoff
+		{
+			void (*invoke)(Handoff & handoff, Fiber & fiber) = nullptr;
+		};
+		
+		/// Suspend the current fiber and, once it has been switched out, invoke the handoff on this thread, which must arrange for another thread to resume it. The fiber's caller continues as though it had yielded, but must not resume the fiber again. The fiber must not be run by a scheduler, which moves fibers between its workers itself.
+		/// Thread-local state, such as the timer wheel or reactor, must be looked up again once the fiber has been resumed, and the fiber must be finished and destroyed by its new thread, so fibers owned by a pool should return to the pool's thread before finishing.
+		/// @returns false if the fiber has been asked to stop.
+		bool migrate(Handoff & handoff);
+		
 		/// Resumes the fiber, raising the Stop exception.
 		void stop();
 
@@ -90,13 +144,54 @@ namespace Concurrent
 			_status = Status::STOPPED;
 		}
 		
-		/// Yield the calling fiber until this fiber completes execution.
-		void wait();
+		/// Ask the fiber to finish, without unwinding its stack. Suspend points which can report this, such as yield and Condition::wait, return false, and the fiber should then return. Suspend points which can't report it, such as Mutex::lock, raise Stop instead.
+		/// A fiber which isn't run by a scheduler is woken if it is suspended, so this must be called on its thread. A fiber run by a scheduler can be asked from any thread, and is made ready if it is waiting on a Condition or one of the primitives built on Waiters. Otherwise, e.g. while it sleeps, it notices the request at its next suspend point.
+		void request_stop();
+		
+		bool stop_requested() const noexcept {return _stop_requested.load(std::memory_order_relaxed);}
+		
+		/// Yield the calling fiber until this fiber completes execution. Returns immediately if it has already completed.
+		/// @returns false if the calling fiber has been asked to stop, in which case this fiber may still be running.
+		bool wait();
+		
+		/// The condition which is resumed once the fiber completes, e.g. to await it from a coroutine.
+		Condition & completion() noexcept {return _completion;}
+		
+		/// Resume the fiber, or if it is run by a scheduler, make it ready to be resumed by a worker. Otherwise, if the current thread has a Loop, the fiber is queued to be resumed by the loop.
+		void schedule();
+		
+		/// Drop the stack pages below the point where this fiber is suspended, e.g. after it has returned from a deep call to wait for a long time. This fiber must not be running, on this or any other thread.
+		/// @returns the number of bytes which were trimmed.
+		std::size_t trim();
+		
+		/// Suspend the current fiber for at least the given duration, using the timer wheel of the current thread.
+		/// @returns false if the fiber was asked to stop, in which case it may have been woken early.
+		static bool sleep(Timer::Clock::duration duration);
+		
+		/// Give the other fibers of this thread a turn, if the current fiber has run for longer than its budget since it was last resumed. This is cheap enough to call in hot loops, as the clock is only read on the first call after each switch, and then every Watchdog::Slice::CHECK_INTERVAL calls. A fiber run by a scheduler or loop is rescheduled, and any other fiber yields to its caller.
+		/// @returns false if the fiber has been asked to stop.
+		static bool maybe_yield()
+		{
+			auto slice = Watchdog::Slice::current();
+			
+			if (slice && slice->expired()) return current->pass();
+			
+			return !current->stop_requested();
+		}
+		
+		/// The longest the fiber runs before maybe_yield gives other fibers a turn, or zero if it never does.
+		Timer::Clock::duration budget() const noexcept {return _budget;}
+		void budget(Timer::Clock::duration budget) noexcept {_budget = budget;}
 		
-		void annotate(const std::string & annotation) {_annotation = annotation;}
+		void annotate(const char * annotation) noexcept;
+		void annotate(const std::string & annotation) noexcept {annotate(annotation.c_str());}
 		
-		const std::string & annotation() const {return _annotation;}
+		const char * annotation() const noexcept {return _annotation;}
 		Stack & stack() {return _stack;}
+		const Stack & stack() const {return _stack;}
+		
+		/// The scheduler which runs this fiber, if any.
+		Scheduler * scheduler() const noexcept {return _scheduler;}
 		
 	private:
 		class Context : public CoroutineContext
@@ -107,7 +202,7 @@ namespace Concurrent
 			template <typename FunctionT>
 			Context(Stack & stack, FunctionT && function)
 			{
-				auto * coentry = emplace_coentry(stack, std::move(function));
+				auto * coentry = emplace_coentry(stack, std::forward<FunctionT>(function));
 				
 				coroutine_initialize(this, coentry->cocall, coentry, stack.current(), stack.size());
 			}
@@ -120,6 +215,27 @@ namespace Concurrent
 		
 		[[noreturn]] void coreturn();
 
+		// Stop the fiber if it is still running, and report any exception it exited with.
+		void finalize();
+		
+		// Give other fibers a turn, once the fiber has used up its budget.
+		bool pass();
+		
+		// Where a fiber run by a scheduler is waiting, so that request_stop can remove it from the wait list and make it ready. It is registered with the primitive's lock held, and cleared by whoever removes the waiter, also with the lock held:
+		struct Parking
+		{
+			Spinlock * lock;
+			Link * node;
+			std::size_t * count;
+		};
+		
+		// Register where the fiber is about to suspend.
+		// @returns false if the fiber has already been asked to stop, in which case it must not suspend.
+		bool park(Parking & parking) noexcept;
+		
+		// Clear the registration once the waiter has been removed, with the primitive's lock held.
+		void unpark() noexcept;
+		
 #if defined(CONCURRENT_SANITIZE_ADDRESS)
 		void * _fake_stack = nullptr;
 		const void * _from_stack_bottom = nullptr;
@@ -133,7 +249,29 @@ namespace Concurrent
 #endif
 		
 		Status _status = Status::READY;
-		std::string _annotation;
+		char _annotation[ANNOTATION_SIZE] = {};
+		
+		// Links the fiber into the registry, if it was enabled when the fiber was created:
+		Registry::Node _registration{this};
+		
+		// Links the fiber into the ready queue of a Loop:
+		Loop::Node _node{this};
+		
+		// Links the fiber into the wait list of at most one Condition at a time:
+		Condition::Node _waiter{this};
+		
+		// Set by request_stop, possibly from another thread if the fiber is run by a scheduler:
+		std::atomic<bool> _stop_requested{false};
+		
+		// Taken before the lock of the primitive the fiber is parked on by request_stop, and after it by everyone else:
+		Spinlock _parking_lock;
+		Parking * _parking = nullptr;
+		
+		Timer::Clock::duration _budget = DEFAULT_BUDGET;
+		
+		// Set whenever the fiber is resumed, so that a pool can tell which fibers have been idle:
+		bool _resumed = false;
+		bool _trimmed = false;
 		
 		Stack _stack;
 		Context _context;
@@ -143,36 +281,122 @@ namespace Concurrent
 		Condition _completion;
 		Fiber * _caller = nullptr;
 		
+		// Set by migrate, or by a task group when a task finishes, and invoked by resume once the fiber has been switched out:
+		Handoff * _handoff = nullptr;
+		
+		Scheduler * _scheduler = nullptr;
+		
 		template <typename>
 		friend struct Coentry;
 		
+		friend class Scheduler;
+		friend class Condition;
+		friend class Waiters;
+		friend class Loop;
+		friend class TaskGroup;
+		
 	public:
 		class Pool
 		{
 		public:
-			Pool(std::size_t stack_size = DEFAULT_STACK_SIZE);
+			// The default number of unused stacks kept for reuse.
+			static constexpr std::size_t DEFAULT_MAXIMUM_STACKS = 64;
+			
+			/// @param maximum_stacks the number of unused stacks to keep for reuse, any more than this are unmapped.
+			/// @param release_stacks whether to advise the kernel that cached stacks can be reclaimed.
+			/// @param options the placement of new stacks.
+			Pool(std::size_t stack_size = DEFAULT_STACK_SIZE, std::size_t maximum_stacks = DEFAULT_MAXIMUM_STACKS, bool release_stacks = false, const Stack::Options & options = Stack::Options());
+			
+			/// Allocate stacks from the given arena, which must outlive the pool.
+			Pool(Stack::Arena & arena, std::size_t maximum_stacks = DEFAULT_MAXIMUM_STACKS, bool release_stacks = false);
+			
 			~Pool();
 			
 			Pool(const Pool & other) = delete;
 			Pool & operator=(const Pool & other) = delete;
 			
+			/// Resume a new fiber, reusing the stack of a finished fiber if possible. The returned fiber is owned by the pool, and is reaped some time after it finishes. The fiber is emplaced on its stack, so once the pool has cached enough stacks, this doesn't allocate.
 			template <typename FunctionT>
 			Fiber & resume(FunctionT && function)
 			{
-				_fibers.emplace_back(function);
+				reap();
 				
-				auto & fiber = _fibers.back();
+				auto stack = acquire();
+				auto member = stack.emplace<Member>();
 				
-				fiber.resume();
+				auto fiber = Fiber::emplace(std::move(stack), [this, member, function = std::forward<FunctionT>(function)]() mutable {
+					Reaper reaper(*this, member);
+					
+					function();
+				});
 				
-				return fiber;
+				member->fiber = fiber;
+				_fibers.push_back(*member);
+				_count += 1;
+				
+				fiber->resume();
+				
+				return *fiber;
 			}
 			
+			/// Release the stacks of all finished fibers, so that they can be reused.
+			void reap();
+			
+			/// Ask every fiber in the pool to stop, which is much cheaper than unwinding them when the pool is destroyed, if they return once asked.
+			void request_stop();
+			
+			/// The number of fibers which have not yet been reaped.
+			std::size_t count() const noexcept {return _count;}
+			
+			/// The number of stacks available for reuse.
+			std::size_t cached() const noexcept {return _stacks.size();}
+			
+			/// Trim the stacks of suspended fibers which have not been resumed for at least the given duration. Fibers are only checked if it has been that long since they were last checked, so this is cheap enough to call often, e.g. from an accept loop, and a fiber is trimmed once it has been idle for between one and two periods.
+			/// @returns the number of bytes which were trimmed.
+			std::size_t trim(Timer::Clock::duration idle);
+			
+			/// Record the stack usage of each fiber in the given sizing when it is reaped, or stop recording if null. Cached stacks are discarded rather than released, so that their usage isn't counted again by the next fiber.
+			void track(Sizing * sizing) noexcept {_sizing = sizing;}
+			
 		protected:
+			// Links a fiber into the pool. It is emplaced on the fiber's stack, above the fiber itself.
+			struct Member : public Link
+			{
+				Fiber * fiber = nullptr;
+			};
+			
+			// Records the fiber as finished when it exits, so it can be reaped without searching.
+			struct Reaper
+			{
+				Pool & pool;
+				Member * member;
+				
+				Reaper(Pool & pool_, Member * member_) : pool(pool_), member(member_) {}
+				~Reaper() {pool._finished.push_back(member);}
+			};
+			
+			Stack acquire();
+			void release(Stack && stack);
+			
 			std::size_t _stack_size = 0;
+			Stack::Options _options;
+			Stack::Arena * _arena = nullptr;
+			
+			std::size_t _maximum_stacks = 0;
+			bool _release_stacks = false;
+			
+			Sizing * _sizing = nullptr;
+			
+			// When fibers were last checked for being idle:
+			Timer::Clock::time_point _checked;
+			
+			std::vector<Stack> _stacks;
+			
+			// Fibers which have exited, and may be ready to be reaped:
+			std::vector<Member *> _finished;
 			
-			std::list<Stack> _stacks;
-			std::list<Fiber> _fibers;
+			Link _fibers;
+			std::size_t _count = 0;
 		};
 	};
 	
@@ -0,0 +1,52 @@
+//
+//  Latch.cpp
+//  File file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Latch.hpp"
+
+#include <cassert>
+
+namespace Concurrent
+{
+	void Latch::count_down(std::size_t count)
+	{
+		_lock.lock();
+		
+		assert(_count >= count);
+		_count -= count;
+		
+		if (_count != 0) {
+			_lock.unlock();
+			
+			return;
+		}
+		
+		_generation += 1;
+		
+		// Fibers which start waiting after this would see the next generation and wait again, so they don't need to be woken:
+		auto waiting = _waiters.count();
+		_lock.unlock();
+		
+		_waiters.wake(waiting, _lock);
+	}
+	
+	void Latch::wait()
+	{
+		_lock.lock();
+		
+		if (_count != 0) {
+			auto generation = _generation;
+			
+			do {
+				_waiters.wait(_lock);
+				_lock.lock();
+			} while (generation == _generation);
+		}
+		
+		_lock.unlock();
+	}
+}
@@ -0,0 +1,78 @@
+//
+//  Latch.hpp
+//  File file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Waiters.hpp"
+
+namespace Concurrent
+{
+	// A counter which fibers can wait on until it reaches zero. Once it has, all waiting fibers are woken, and it can't be reused.
+	class Latch
+	{
+	public:
+		explicit Latch(std::size_t count) noexcept : _count(count) {}
+		
+		Latch(const Latch & other) = delete;
+		Latch & operator=(const Latch & other) = delete;
+		
+		/// Decrement the counter, waking all waiting fibers if it reaches zero.
+		void count_down(std::size_t count = 1);
+		
+		/// Whether the counter has reached zero.
+		bool try_wait() const noexcept
+		{
+			std::lock_guard<Spinlock> lock(_lock);
+			
+			return _count == 0;
+		}
+		
+		/// Suspend the current fiber until the counter reaches zero.
+		void wait();
+		
+		void arrive_and_wait(std::size_t count = 1)
+		{
+			count_down(count);
+			wait();
+		}
+		
+	protected:
+		void add(std::size_t count) noexcept
+		{
+			std::lock_guard<Spinlock> lock(_lock);
+			
+			_count += count;
+		}
+		
+	private:
+		mutable Spinlock _lock;
+		
+		std::size_t _count;
+		
+		// Incremented each time the counter reaches zero, so that waiting fibers can tell they were woken by it:
+		std::size_t _generation = 0;
+		
+		Waiters _waiters;
+	};
+	
+	// Waits for a group of tasks to finish. Unlike a Latch, tasks can be added again once the group has finished.
+	class WaitGroup : private Latch
+	{
+	public:
+		WaitGroup() noexcept : Latch(0) {}
+		
+		/// Add the given number of tasks to the group.
+		using Latch::add;
+		
+		/// Mark one task as finished.
+		void done() {count_down();}
+		
+		/// Suspend the current fiber until all tasks have finished.
+		using Latch::wait;
+	};
+}
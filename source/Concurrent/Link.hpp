@@ -0,0 +1,57 @@
+//
+//  Link.hpp
+//  File file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+namespace Concurrent
+{
+	// A node in an intrusive, circular, doubly-linked list. A list is represented by a sentinel node, which links to itself when the list is empty. Nodes can be unlinked in constant time without knowing which list they belong to.
+	struct Link
+	{
+		Link * next = this;
+		Link * previous = this;
+		
+		Link() noexcept {}
+		
+		Link(const Link & other) = delete;
+		Link & operator=(const Link & other) = delete;
+		
+		// For a sentinel, whether the list is empty. For any other node, whether it is in a list.
+		bool empty() const noexcept {return next == this;}
+		bool linked() const noexcept {return next != this;}
+		
+		// Insert the given node before this one, i.e. at the back of the list if this is the sentinel.
+		void push_back(Link & node) noexcept
+		{
+			node.next = this;
+			node.previous = previous;
+			previous->next = &node;
+			previous = &node;
+		}
+		
+		void unlink() noexcept
+		{
+			next->previous = previous;
+			previous->next = next;
+			next = previous = this;
+		}
+		
+		// Move all nodes from the given sentinel to the back of this list.
+		void splice(Link & other) noexcept
+		{
+			if (other.empty()) return;
+			
+			other.next->previous = previous;
+			other.previous->next = this;
+			previous->next = other.next;
+			previous = other.previous;
+			
+			other.next = other.previous = &other;
+		}
+	};
+}
@@ -0,0 +1,51 @@
+//
+//  Loop.cpp
+//  File file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Loop.hpp"
+
+#include "Fiber.hpp"
+
+namespace Concurrent
+{
+	thread_local Loop * Loop::_current = nullptr;
+	
+	Loop::Loop() noexcept : _previous(_current)
+	{
+		_current = this;
+	}
+	
+	Loop::~Loop() noexcept(false)
+	{
+		_current = _previous;
+		
+		// Fibers which were woken while the loop existed still expect to run:
+		run();
+	}
+	
+	void Loop::push(Fiber * fiber) noexcept
+	{
+		if (fiber->_node.linked()) return;
+		
+		_ready.push_back(fiber->_node);
+	}
+	
+	std::size_t Loop::run()
+	{
+		std::size_t count = 0;
+		
+		while (!_ready.empty()) {
+			auto node = static_cast<Node *>(_ready.next);
+			node->unlink();
+			
+			node->fiber->resume();
+			count += 1;
+		}
+		
+		return count;
+	}
+}
@@ -0,0 +1,59 @@
+//
+//  Loop.hpp
+//  File file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Link.hpp"
+
+#include <cstddef>
+
+namespace Concurrent
+{
+	class Fiber;
+	
+	// A queue of fibers which are ready to run on the current thread. While a loop exists, fibers which aren't run by a Scheduler are queued when they are woken, e.g. by a Condition, rather than being resumed on the call stack of whoever woke them. The loop then resumes them one at a time, in the order they were woken, so waking fibers is cheap for the waker, and fibers which wake each other don't nest.
+	class Loop
+	{
+	public:
+		// Links a fiber into the queue. This is separate from the link which joins a fiber to the wait list of a Condition.
+		struct Node : public Link
+		{
+			Node(Fiber * fiber_) noexcept : fiber(fiber_) {}
+			
+			Fiber * fiber;
+		};
+		
+		/// The loop becomes the current loop of this thread, until it is destroyed.
+		Loop() noexcept;
+		
+		/// Runs any fibers which are still ready, and restores the previous loop.
+		~Loop() noexcept(false);
+		
+		Loop(const Loop & other) = delete;
+		Loop & operator=(const Loop & other) = delete;
+		
+		/// The loop of the current thread, if any.
+		static Loop * current() noexcept {return _current;}
+		
+		/// Queue a fiber to be resumed by the loop. A fiber which is already queued is not queued again.
+		void push(Fiber * fiber) noexcept;
+		
+		/// Resume ready fibers until there are none, including fibers woken along the way. If a fiber exits with an exception, it is rethrown, and the remaining fibers stay queued.
+		/// @returns the number of fibers which were resumed.
+		std::size_t run();
+		
+		bool empty() const noexcept {return _ready.empty();}
+		
+	private:
+		thread_local static Loop * _current;
+		
+		Loop * _previous;
+		
+		Link _ready;
+	};
+}
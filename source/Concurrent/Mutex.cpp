@@ -0,0 +1,55 @@
+//
+//  Mutex.cpp
+//  File file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Mutex.hpp"
+
+namespace Concurrent
+{
+	void Mutex::wait()
+	{
+		_lock.lock();
+		
+		// Waiters are only added with the lock held, so marking the state as contended ensures the owner takes the slow path and finds us:
+		auto state = _state.load(std::memory_order_relaxed);
+		
+		while (true) {
+			if (state == UNLOCKED) {
+				if (_state.compare_exchange_weak(state, _waiters.empty() ? LOCKED : CONTENDED, std::memory_order_acquire, std::memory_order_relaxed)) {
+					_lock.unlock();
+					
+					return;
+				}
+			} else if (state == CONTENDED || _state.compare_exchange_weak(state, CONTENDED, std::memory_order_relaxed, std::memory_order_relaxed)) {
+				break;
+			}
+		}
+		
+		// Once woken, this fiber owns the mutex. If it is stopped before it can run, ownership is passed on:
+		_waiters.wait(_lock, [this]{unlock();});
+		
+		std::atomic_thread_fence(std::memory_order_acquire);
+	}
+	
+	void Mutex::handoff()
+	{
+		_lock.lock();
+		
+		auto waiter = _waiters.pop();
+		
+		if (waiter) {
+			// The mutex remains locked, on behalf of the woken fiber:
+			_state.store(_waiters.empty() ? LOCKED : CONTENDED, std::memory_order_release);
+		} else {
+			_state.store(UNLOCKED, std::memory_order_release);
+		}
+		
+		_lock.unlock();
+		
+		if (waiter) waiter->schedule();
+	}
+}
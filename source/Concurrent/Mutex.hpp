@@ -0,0 +1,76 @@
+//
+//  Mutex.hpp
+//  File file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Waiters.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace Concurrent
+{
+	// A mutual exclusion lock which suspends the current fiber rather than blocking the thread. It is compatible with std::lock_guard and std::unique_lock. When unlocked with fibers waiting, ownership is handed directly to the fiber which has been waiting the longest, so a fiber which unlocks and immediately locks again can't starve the others.
+	class Mutex
+	{
+	public:
+		Mutex() noexcept {}
+		
+		Mutex(const Mutex & other) = delete;
+		Mutex & operator=(const Mutex & other) = delete;
+		
+		void lock()
+		{
+			std::uint8_t expected = UNLOCKED;
+			
+			if (!_state.compare_exchange_strong(expected, LOCKED, std::memory_order_acquire, std::memory_order_relaxed)) {
+				wait();
+			}
+		}
+		
+		bool try_lock() noexcept
+		{
+			std::uint8_t expected = UNLOCKED;
+			
+			return _state.compare_exchange_strong(expected, LOCKED, std::memory_order_acquire, std::memory_order_relaxed);
+		}
+		
+		void unlock()
+		{
+			std::uint8_t expected = LOCKED;
+			
+			if (!_state.compare_exchange_strong(expected, UNLOCKED, std::memory_order_release, std::memory_order_relaxed)) {
+				handoff();
+			}
+		}
+		
+		/// The number of fibers waiting to lock the mutex.
+		std::size_t count() const noexcept
+		{
+			std::lock_guard<Spinlock> lock(_lock);
+			
+			return _waiters.count();
+		}
+		
+	private:
+		enum : std::uint8_t {
+			UNLOCKED = 0,
+			LOCKED = 1,
+			// Locked, and there may be fibers waiting, so unlocking must take the slow path:
+			CONTENDED = 2,
+		};
+		
+		void wait();
+		void handoff();
+		
+		std::atomic<std::uint8_t> _state{UNLOCKED};
+		
+		mutable Spinlock _lock;
+		Waiters _waiters;
+	};
+}
@@ -0,0 +1,98 @@
+//
+//  Notification.cpp
+//  File file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Notification.hpp"
+
+#if defined(__linux__)
+
+#include <thread>
+#include <system_error>
+
+#include <errno.h>
+
+namespace Concurrent
+{
+	constexpr std::size_t Notification::RESUME;
+	
+	static Reactor & current_reactor()
+	{
+		auto reactor = Reactor::current();
+		
+		if (reactor == nullptr) {
+			throw std::system_error(ENXIO, std::generic_category(), "Notification::Notification");
+		}
+		
+		return *reactor;
+	}
+	
+	Notification::Notification(Condition & condition, Reactor & reactor) : _condition(condition), _reactor(reactor)
+	{
+		this->invoke = &Notification::wake;
+	}
+	
+	Notification::Notification(Condition & condition) : Notification(condition, current_reactor())
+	{
+	}
+	
+	Notification::~Notification()
+	{
+		// The reactor still refers to a posted notification, which may not have reached its inbox yet:
+		while (pending()) {
+			_reactor.flush();
+			
+			if (pending()) std::this_thread::yield();
+		}
+	}
+	
+	void Notification::signal() noexcept
+	{
+		_signals.fetch_add(1);
+		
+		post();
+	}
+	
+	void Notification::resume() noexcept
+	{
+		_signals.fetch_or(RESUME);
+		
+		post();
+	}
+	
+	void Notification::post() noexcept
+	{
+		// The signals are recorded first, so that the reactor can't run the notification without them:
+		if (!_posted.exchange(true)) {
+			_reactor.post(*this);
+		}
+	}
+	
+	void Notification::wake(Reactor::Task & task)
+	{
+		auto & notification = static_cast<Notification &>(task);
+		auto & condition = notification._condition;
+		
+		// Any signals which arrive from now on post the notification again:
+		notification._posted.store(false);
+		auto signals = notification._signals.exchange(0);
+		
+		// A woken fiber may destroy the notification, so only the condition is used from here on:
+		if (signals & RESUME) {
+			condition.resume();
+		} else {
+			// Fibers which wait again once woken go to the back, so only those waiting now are woken:
+			auto waiting = condition.count();
+			if (signals > waiting) signals = waiting;
+			
+			while (signals > 0 && condition.signal()) {
+				signals -= 1;
+			}
+		}
+	}
+}
+
+#endif
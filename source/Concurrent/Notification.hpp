@@ -0,0 +1,61 @@
+//
+//  Notification.hpp
+//  File file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Condition.hpp"
+#include "Reactor.hpp"
+
+#include <atomic>
+
+namespace Concurrent
+{
+#if defined(__linux__)
+	// Wakes fibers waiting on a condition from any thread. A fiber which isn't run by a Scheduler must only be resumed by its own thread, so rather than signalling the condition directly, other threads post the notification to the reactor of the condition's thread, which signals it during its next update. Notifications which arrive before then are combined, so a burst of signals from any number of threads costs a single post and at most one system call.
+	class Notification : private Reactor::Task
+	{
+	public:
+		/// @param reactor the reactor of the thread whose fibers wait on the condition.
+		Notification(Condition & condition, Reactor & reactor);
+		
+		/// Use the reactor of the current thread, raising an error if there isn't one.
+		explicit Notification(Condition & condition);
+		
+		// Runs any notification which is still pending, so it must be destroyed on the reactor's thread once other threads have stopped using it.
+		~Notification();
+		
+		Notification(const Notification & other) = delete;
+		Notification & operator=(const Notification & other) = delete;
+		
+		/// Wake the fiber which has been waiting the longest. Each signal wakes at most one fiber, and signals which are combined only wake fibers which are waiting when the reactor runs the notification, so signals with no fiber waiting are lost, as with Condition::signal. This can be called from any thread.
+		void signal() noexcept;
+		
+		/// Wake all fibers which are waiting. This can be called from any thread.
+		void resume() noexcept;
+		
+		/// Whether a notification has been posted which the reactor hasn't run yet.
+		bool pending() const noexcept {return _posted.load(std::memory_order_acquire);}
+		
+	private:
+		// Set in the signal count by resume:
+		static constexpr std::size_t RESUME = ~(~std::size_t(0) >> 1);
+		
+		// Post the notification to the reactor, unless it is already pending.
+		void post() noexcept;
+		
+		// Run on the reactor's thread:
+		static void wake(Reactor::Task & task);
+		
+		Condition & _condition;
+		Reactor & _reactor;
+		
+		std::atomic<std::size_t> _signals{0};
+		std::atomic<bool> _posted{false};
+	};
+#endif
+}
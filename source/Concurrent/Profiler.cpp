@@ -0,0 +1,298 @@
+//
+//  Profiler.cpp
+//  File file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Profiler.hpp"
+
+#if defined(__linux__)
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <unordered_map>
+
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+#include <cxxabi.h>
+#include <dlfcn.h>
+#include <signal.h>
+#include <sys/time.h>
+#include <ucontext.h>
+
+namespace Concurrent
+{
+	constexpr std::size_t Profiler::DEFAULT_FREQUENCY;
+	constexpr std::size_t Profiler::DEFAULT_CAPACITY;
+	constexpr std::size_t Profiler::DEPTH;
+	
+	namespace
+	{
+		// A sample, and whether the handler has finished writing it:
+		struct Slot
+		{
+			Profiler::Sample sample;
+			std::atomic<bool> complete{false};
+		};
+		
+		// Serialises starting and stopping:
+		std::mutex lock;
+		bool installed = false;
+		
+		std::unique_ptr<Slot[]> buffer;
+		std::size_t capacity = 0;
+		
+		// The buffer which the handler writes into, or null while profiling is stopped:
+		std::atomic<Slot *> slots{nullptr};
+		std::atomic<std::size_t> next{0};
+		std::atomic<std::size_t> dropped{0};
+		
+		// The number of handlers which may be using the buffer:
+		std::atomic<std::size_t> active{0};
+		
+		// Read the interrupted instruction, stack pointer and frame pointer:
+		bool registers(const ucontext_t * context, void *& pc, std::uintptr_t & sp, std::uintptr_t & fp) noexcept
+		{
+#if defined(__x86_64__)
+			pc = reinterpret_cast<void *>(context->uc_mcontext.gregs[REG_RIP]);
+			sp = static_cast<std::uintptr_t>(context->uc_mcontext.gregs[REG_RSP]);
+			fp = static_cast<std::uintptr_t>(context->uc_mcontext.gregs[REG_RBP]);
+			
+			return true;
+#elif defined(__aarch64__)
+			pc = reinterpret_cast<void *>(context->uc_mcontext.pc);
+			sp = static_cast<std::uintptr_t>(context->uc_mcontext.sp);
+			fp = static_cast<std::uintptr_t>(context->uc_mcontext.regs[29]);
+			
+			return true;
+#else
+			return false;
+#endif
+		}
+		
+		// Walk the frames of the interrupted code, which must lie between the stack pointer and the top of the fiber's stack:
+		std::size_t unwind(const ucontext_t * context, Fiber * fiber, void ** frames) noexcept
+		{
+			void * pc = nullptr;
+			std::uintptr_t sp = 0, fp = 0;
+			
+			if (!registers(context, pc, sp, fp)) return 0;
+			
+			std::size_t depth = 0;
+			frames[depth++] = pc;
+			
+			if (fiber == nullptr || fiber->status() == Status::MAIN) return depth;
+			
+			auto & stack = fiber->stack();
+			auto bottom = std::max(sp, reinterpret_cast<std::uintptr_t>(stack.base()));
+			auto top = reinterpret_cast<std::uintptr_t>(stack.top());
+			
+			// If the fiber is being switched, the stack pointer may be on another stack, and nothing is walked:
+			while (depth < Profiler::DEPTH && fp >= bottom && fp + 2 * sizeof(void *) <= top && (fp % sizeof(void *)) == 0) {
+				auto frame = reinterpret_cast<const std::uintptr_t *>(fp);
+				
+				if (frame[1] == 0) break;
+				frames[depth++] = reinterpret_cast<void *>(frame[1]);
+				
+				// Frames are pushed downwards, so the caller's frame is always higher:
+				if (frame[0] <= fp) break;
+				fp = frame[0];
+			}
+			
+			return depth;
+		}
+		
+		void handle(int, siginfo_t *, void * context)
+		{
+			auto error = errno;
+			
+			active.fetch_add(1);
+			
+			auto slots = Concurrent::slots.load();
+			
+			if (slots) {
+				auto index = next.fetch_add(1, std::memory_order_relaxed);
+				
+				if (index < capacity) {
+					auto & slot = slots[index];
+					auto & sample = slot.sample;
+					
+					// Fiber::current is initialized dynamically on first use, which isn't async-signal-safe:
+					auto fiber = Fiber::active.load(std::memory_order_relaxed);
+					
+					std::strncpy(sample.annotation, fiber ? fiber->annotation() : "main", Fiber::ANNOTATION_SIZE - 1);
+					sample.annotation[Fiber::ANNOTATION_SIZE - 1] = '\0';
+					
+					sample.fiber = fiber;
+					sample.depth = unwind(static_cast<const ucontext_t *>(context), fiber, sample.frames);
+					
+					slot.complete.store(true, std::memory_order_release);
+				} else {
+					Concurrent::dropped.fetch_add(1, std::memory_order_relaxed);
+				}
+			}
+			
+			active.fetch_sub(1);
+			
+			errno = error;
+		}
+		
+		// Name a frame. Return addresses point after the call, so they are moved back into the calling instruction:
+		std::string symbolize(void * address, bool call)
+		{
+			auto target = static_cast<char *>(address) - (call ? 1 : 0);
+			
+			Dl_info information = {};
+			std::ostringstream name;
+			
+			if (!dladdr(target, &information)) {
+				name << address;
+			} else if (information.dli_sname) {
+				int status = 0;
+				auto demangled = abi::__cxa_demangle(information.dli_sname, nullptr, nullptr, &status);
+				
+				if (demangled) {
+					name << demangled;
+					std::free(demangled);
+				} else {
+					name << information.dli_sname;
+				}
+			} else if (information.dli_fname && information.dli_fname[0]) {
+				auto module = std::strrchr(information.dli_fname, '/');
+				
+				name << (module ? module + 1 : information.dli_fname) << "+0x" << std::hex << (target - static_cast<char *>(information.dli_fbase));
+			} else {
+				name << address;
+			}
+			
+			return name.str();
+		}
+	}
+	
+	void Profiler::start(std::size_t frequency, std::size_t capacity)
+	{
+		std::lock_guard<std::mutex> guard(Concurrent::lock);
+		
+		if (Concurrent::slots.load()) {
+			throw std::system_error(EBUSY, std::generic_category(), "Profiler::start");
+		}
+		
+		if (!installed) {
+			struct sigaction action = {};
+			action.sa_sigaction = handle;
+			action.sa_flags = SA_SIGINFO | SA_RESTART;
+			sigemptyset(&action.sa_mask);
+			
+			if (sigaction(SIGPROF, &action, nullptr) == -1) {
+				throw std::system_error(errno, std::generic_category(), "sigaction(...)");
+			}
+			
+			installed = true;
+		}
+		
+		buffer.reset(new Slot[capacity]);
+		Concurrent::capacity = capacity;
+		
+		next.store(0);
+		Concurrent::dropped.store(0);
+		Concurrent::slots.store(buffer.get());
+		
+		auto interval = std::max<long>(1000000 / frequency, 1);
+		
+		struct itimerval timer = {};
+		timer.it_interval.tv_sec = interval / 1000000;
+		timer.it_interval.tv_usec = interval % 1000000;
+		timer.it_value = timer.it_interval;
+		
+		if (setitimer(ITIMER_PROF, &timer, nullptr) == -1) {
+			auto error = errno;
+			
+			Concurrent::slots.store(nullptr);
+			
+			throw std::system_error(error, std::generic_category(), "setitimer(...)");
+		}
+	}
+	
+	void Profiler::stop()
+	{
+		std::lock_guard<std::mutex> guard(Concurrent::lock);
+		
+		struct itimerval timer = {};
+		setitimer(ITIMER_PROF, &timer, nullptr);
+		
+		Concurrent::slots.store(nullptr);
+		
+		// A handler which loaded the buffer before it was cleared may still be writing a sample:
+		while (active.load() != 0) {
+			std::this_thread::yield();
+		}
+	}
+	
+	bool Profiler::running() noexcept
+	{
+		return Concurrent::slots.load(std::memory_order_relaxed) != nullptr;
+	}
+	
+	std::vector<Profiler::Sample> Profiler::samples()
+	{
+		std::lock_guard<std::mutex> guard(Concurrent::lock);
+		
+		std::vector<Sample> samples;
+		
+		auto count = std::min(next.load(), Concurrent::capacity);
+		
+		for (std::size_t i = 0; i < count; i += 1) {
+			if (buffer[i].complete.load(std::memory_order_acquire)) {
+				samples.push_back(buffer[i].sample);
+			}
+		}
+		
+		return samples;
+	}
+	
+	std::size_t Profiler::dropped() noexcept
+	{
+		return Concurrent::dropped.load(std::memory_order_relaxed);
+	}
+	
+	void Profiler::write(std::ostream & output)
+	{
+		std::map<std::string, std::size_t> stacks;
+		std::unordered_map<void *, std::string> symbols;
+		
+		for (auto & sample : samples()) {
+			std::string stack = sample.annotation[0] ? sample.annotation : "[fiber]";
+			
+			for (std::size_t i = sample.depth; i > 0; i -= 1) {
+				auto address = sample.frames[i - 1];
+				auto symbol = symbols.find(address);
+				
+				if (symbol == symbols.end()) {
+					symbol = symbols.emplace(address, symbolize(address, i > 1)).first;
+				}
+				
+				stack += ';';
+				stack += symbol->second;
+			}
+			
+			stacks[stack] += 1;
+		}
+		
+		for (auto & stack : stacks) {
+			output << stack.first << ' ' << stack.second << '\n';
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,66 @@
+//
+//  Profiler.hpp
+//  File file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Fiber.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <ostream>
+#include <vector>
+
+namespace Concurrent
+{
+#if defined(__linux__)
+	// A sampling profiler which attributes each sample to the fiber which was running, rather than to whichever native stack the sample landed on. SIGPROF is delivered to the thread which is using the CPU, at a fixed rate of CPU time. The handler copies the current fiber's annotation, and walks frame pointers only within the active fiber's stack, so that samples don't include the frames of the fiber which resumed it. Samples are written into a buffer which is allocated when profiling starts, so the handler doesn't take a lock or allocate.
+	// Frames are found by following frame pointers, so code should be compiled with -fno-omit-frame-pointer, otherwise stacks are cut short. Samples taken on the main fiber of a thread only record the interrupted instruction, as the bounds of the thread's own stack aren't known.
+	class Profiler
+	{
+	public:
+		// Samples per second of CPU time.
+		static constexpr std::size_t DEFAULT_FREQUENCY = 1000;
+		
+		// The number of samples kept, after which further samples are dropped.
+		static constexpr std::size_t DEFAULT_CAPACITY = 1024*16;
+		
+		// The maximum number of frames in each sample.
+		static constexpr std::size_t DEPTH = 64;
+		
+		struct Sample
+		{
+			// Copied from the fiber, which may no longer exist when the samples are written:
+			char annotation[Fiber::ANNOTATION_SIZE];
+			
+			// Null if the thread hadn't switched fibers yet, in which case its main fiber was running:
+			const Fiber * fiber;
+			
+			// The interrupted instruction, followed by the return addresses of the frames which called it, innermost first:
+			std::size_t depth;
+			void * frames[DEPTH];
+		};
+		
+		/// Discard any samples taken previously, and start sampling. The signal handler is installed the first time profiling starts, replacing any other handler of SIGPROF, and stays installed, ignoring signals while profiling is stopped.
+		static void start(std::size_t frequency = DEFAULT_FREQUENCY, std::size_t capacity = DEFAULT_CAPACITY);
+		
+		/// Stop sampling, and wait for any samples being taken by other threads.
+		static void stop();
+		
+		static bool running() noexcept;
+		
+		/// The samples which have been taken, in the order they were taken.
+		static std::vector<Sample> samples();
+		
+		/// The number of samples which were dropped because the buffer was full.
+		static std::size_t dropped() noexcept;
+		
+		/// Write the samples in the folded format used by flame graph tools: one line per distinct stack, naming the fiber's annotation and then each frame from the outermost, separated by semicolons, followed by the number of samples. Frames are named by the symbols exported by their modules, or else by the module and offset.
+		static void write(std::ostream & output);
+	};
+#endif
+}
@@ -0,0 +1,429 @@
+//
+//  Queue.hpp
+//  File file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Waiters.hpp"
+#include "Scheduler.hpp"
+#include "Reactor.hpp"
+
+#include <atomic>
+#include <memory>
+#include <condition_variable>
+#include <type_traits>
+#include <cstdint>
+
+namespace Concurrent
+{
+	// A bounded, lock-free queue which lets any thread, including threads which don't run fibers, send values to fibers. Receivers suspend while the queue is empty. Based on the bounded MPMC queue by Dmitry Vyukov, in which each cell carries a sequence number so that producers and consumers only contend on their own index.
+	// Fibers receiving from the queue must be run by a Scheduler, so that they can be woken from other threads. Senders wait while the queue is full without using the processor: fibers run by a scheduler or a reactor are suspended, and any other thread is blocked.
+	template <typename Type>
+	class Queue
+	{
+		typedef typename std::aligned_storage<sizeof(Type), alignof(Type)>::type Storage;
+		
+		struct Cell
+		{
+			std::atomic<std::size_t> sequence;
+			Storage storage;
+		};
+		
+		// Avoid false sharing between the producer and consumer indexes:
+		static constexpr std::size_t CACHE_LINE_SIZE = 64;
+		
+	public:
+		/// The capacity is rounded up to a power of two, of at least two, as a single cell can't tell whether it holds a value from the current lap or the previous one.
+		explicit Queue(std::size_t capacity)
+		{
+			_capacity = 2;
+			while (_capacity < capacity) _capacity *= 2;
+			
+			_cells.reset(new Cell[_capacity]);
+			
+			for (std::size_t index = 0; index < _capacity; index += 1) {
+				_cells[index].sequence.store(index, std::memory_order_relaxed);
+			}
+		}
+		
+		~Queue()
+		{
+			auto end = _enqueue.load(std::memory_order_relaxed);
+			
+			for (auto position = _dequeue.load(std::memory_order_relaxed); position != end; position += 1) {
+				reinterpret_cast<Type *>(&_cells[position & (_capacity - 1)].storage)->~Type();
+			}
+		}
+		
+		Queue(const Queue & other) = delete;
+		Queue & operator=(const Queue & other) = delete;
+		
+		/// Send a value from any thread, if there is space for it.
+		/// @returns false if the queue is full or closed.
+		bool try_send(Type value)
+		{
+			if (_closed.load(std::memory_order_acquire)) return false;
+			
+			if (!push(value)) return false;
+			
+			notify();
+			
+			return true;
+		}
+		
+		/// Send a value from any thread, waiting while the queue is full. A fiber run by a scheduler or a reactor is suspended while it waits, so the other fibers of its thread keep running. Any other thread, including a fiber run by a Loop, blocks until a value is received.
+		/// @returns false if the queue was closed, in which case the value was not sent. Raises Stop if a suspended fiber is asked to stop.
+		bool send(Type value)
+		{
+			while (!_closed.load(std::memory_order_acquire)) {
+				if (push(value)) {
+					notify();
+					
+					return true;
+				}
+				
+				_lock.lock();
+				
+				// Receivers check this flag after popping, so either they see it and wake us, or we see their space below:
+				_sending.store(true, std::memory_order_relaxed);
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+				
+				if (push(value)) {
+					_lock.unlock();
+					notify();
+					
+					return true;
+				}
+				
+				if (_closed.load(std::memory_order_acquire)) {
+					_lock.unlock();
+					
+					return false;
+				}
+				
+				wait_for_space();
+			}
+			
+			return false;
+		}
+		
+		/// Receive a value if one is available.
+		bool try_recv(Type & value)
+		{
+			if (!pop(value)) return false;
+			
+			notify_sender();
+			
+			return true;
+		}
+		
+		/// Receive a value, suspending the current fiber while the queue is empty.
+		/// @returns false if the queue is closed and all values have been received.
+		bool recv(Type & value)
+		{
+			while (!pop(value)) {
+				_lock.lock();
+				
+				// Senders check this flag after pushing, so either they see it and wake us, or we see their value below:
+				_waiting.store(true, std::memory_order_relaxed);
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+				
+				if (pop(value)) {
+					_lock.unlock();
+					notify_sender();
+					
+					return true;
+				}
+				
+				if (_closed.load(std::memory_order_acquire)) {
+					_lock.unlock();
+					
+					return false;
+				}
+				
+				_receivers.wait(_lock, [this]{wake();});
+			}
+			
+			notify_sender();
+			
+			return true;
+		}
+		
+		/// Prevent any more values from being sent, and wake all waiting senders and receivers. Values which were already sent can still be received.
+		void close()
+		{
+			_closed.store(true, std::memory_order_release);
+			
+			Link posted;
+			
+			_lock.lock();
+			auto receivers = _receivers.count();
+			auto senders = _senders.count();
+			posted.splice(_posted);
+			_blocked.notify_all();
+			_lock.unlock();
+			
+			_receivers.wake(receivers, _lock);
+			_senders.wake(senders, _lock);
+			
+#if defined(__linux__)
+			while (!posted.empty()) {
+				auto sender = static_cast<Sender *>(posted.next);
+				sender->unlink();
+				sender->reactor->post(*sender);
+			}
+#endif
+		}
+		
+		bool closed() const noexcept {return _closed.load(std::memory_order_acquire);}
+		
+		std::size_t capacity() const noexcept {return _capacity;}
+		
+	private:
+#if defined(__linux__)
+		// A sender run by a reactor, which is woken by a task posted to its reactor. It is allocated, so that a task which is already posted can outlive a fiber which is stopped while it waits.
+		struct Sender : public Link, public Reactor::Task
+		{
+			Fiber * fiber = nullptr;
+			Reactor * reactor = nullptr;
+			
+			// Set on the reactor's thread, which is the fiber's thread, so neither needs the lock:
+			bool woken = false;
+			bool detached = false;
+		};
+#endif
+		
+		bool push(Type & value)
+		{
+			auto position = _enqueue.load(std::memory_order_relaxed);
+			
+			while (true) {
+				auto & cell = _cells[position & (_capacity - 1)];
+				auto sequence = cell.sequence.load(std::memory_order_acquire);
+				auto difference = std::intptr_t(sequence) - std::intptr_t(position);
+				
+				if (difference == 0) {
+					if (_enqueue.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+						new(&cell.storage) Type(std::move(value));
+						cell.sequence.store(position + 1, std::memory_order_release);
+						
+						return true;
+					}
+				} else if (difference < 0) {
+					// The cell still holds the value from the previous lap, so the queue is full:
+					return false;
+				} else {
+					position = _enqueue.load(std::memory_order_relaxed);
+				}
+			}
+		}
+		
+		bool pop(Type & value)
+		{
+			auto position = _dequeue.load(std::memory_order_relaxed);
+			
+			while (true) {
+				auto & cell = _cells[position & (_capacity - 1)];
+				auto sequence = cell.sequence.load(std::memory_order_acquire);
+				auto difference = std::intptr_t(sequence) - std::intptr_t(position + 1);
+				
+				if (difference == 0) {
+					if (_dequeue.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+						auto item = reinterpret_cast<Type *>(&cell.storage);
+						
+						value = std::move(*item);
+						item->~Type();
+						
+						cell.sequence.store(position + _capacity, std::memory_order_release);
+						
+						return true;
+					}
+				} else if (difference < 0) {
+					// The cell has not been filled yet, so the queue is empty:
+					return false;
+				} else {
+					position = _dequeue.load(std::memory_order_relaxed);
+				}
+			}
+		}
+		
+		// After pushing a value, wake a receiver if there might be one waiting.
+		void notify()
+		{
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			
+			if (_waiting.load(std::memory_order_relaxed)) wake();
+		}
+		
+		void wake()
+		{
+			_lock.lock();
+			
+			auto waiter = _receivers.pop();
+			
+			if (_receivers.empty()) {
+				_waiting.store(false, std::memory_order_relaxed);
+			}
+			
+			_lock.unlock();
+			
+			if (waiter) waiter->schedule();
+		}
+		
+		// Suspend the current fiber, or block the current thread, until a value has been received or the queue is closed. The lock must be held, and is released before this returns.
+		void wait_for_space()
+		{
+			auto fiber = Fiber::current;
+			
+			if (fiber->scheduler()) {
+				// If the fiber is stopped after being woken, the space it was woken for is passed on:
+				_senders.wait(_lock, [this]{wake_sender();});
+				
+				return;
+			}
+			
+#if defined(__linux__)
+			auto reactor = Reactor::current();
+			
+			if (reactor && fiber->status() != Status::MAIN) {
+				wait_for_space(fiber, reactor);
+				
+				return;
+			}
+#endif
+			
+			_blocking += 1;
+			_blocked.wait(_lock);
+			_blocking -= 1;
+			
+			_lock.unlock();
+		}
+		
+#if defined(__linux__)
+		// Suspend a fiber run by a reactor until a task posted to the reactor wakes it.
+		void wait_for_space(Fiber * fiber, Reactor * reactor)
+		{
+			std::unique_ptr<Sender> sender(new Sender);
+			sender->fiber = fiber;
+			sender->reactor = reactor;
+			sender->invoke = [](Reactor::Task & task) {
+				auto & sender = static_cast<Sender &>(task);
+				
+				// The fiber was stopped after it was woken, and may no longer exist:
+				if (sender.detached) {
+					delete &sender;
+					
+					return;
+				}
+				
+				sender.woken = true;
+				sender.fiber->schedule();
+			};
+			
+			_posted.push_back(*sender);
+			_lock.unlock();
+			
+			try {
+				while (!sender->woken) {
+					if (!reactor->suspend()) throw Stop();
+				}
+			} catch (...) {
+				_lock.lock();
+				
+				bool waiting = sender->linked();
+				if (waiting) sender->unlink();
+				
+				_lock.unlock();
+				
+				if (!waiting) {
+					// The sender was woken, and the task which frees it has been or is about to be posted:
+					if (!sender->woken) {
+						sender->detached = true;
+						sender.release();
+					}
+					
+					wake_sender();
+				}
+				
+				throw;
+			}
+		}
+#endif
+		
+		// After popping a value, wake a sender if there might be one waiting for space.
+		void notify_sender()
+		{
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			
+			if (_sending.load(std::memory_order_relaxed)) wake_sender();
+		}
+		
+		void wake_sender()
+		{
+			_lock.lock();
+			
+			auto waiter = _senders.pop();
+			Link * sender = nullptr;
+			
+			if (waiter == nullptr) {
+				if (!_posted.empty()) {
+					sender = _posted.next;
+					sender->unlink();
+				} else if (_blocking) {
+					_blocked.notify_one();
+				}
+			}
+			
+			if (_senders.empty() && _posted.empty() && _blocking == 0) {
+				_sending.store(false, std::memory_order_relaxed);
+			}
+			
+			_lock.unlock();
+			
+			if (waiter) waiter->schedule();
+			
+#if defined(__linux__)
+			if (sender) {
+				auto & posted = static_cast<Sender &>(*sender);
+				posted.reactor->post(posted);
+			}
+#endif
+		}
+		
+		std::size_t _capacity;
+		std::unique_ptr<Cell[]> _cells;
+		
+		// The queue may be allocated without respecting over-aligned types, so the indexes are padded instead:
+		char _padding0[CACHE_LINE_SIZE];
+		std::atomic<std::size_t> _enqueue{0};
+		
+		char _padding1[CACHE_LINE_SIZE - sizeof(std::atomic<std::size_t>)];
+		std::atomic<std::size_t> _dequeue{0};
+		
+		char _padding2[CACHE_LINE_SIZE - sizeof(std::atomic<std::size_t>)];
+		std::atomic<bool> _closed{false};
+		
+		// Whether any receivers may be waiting, so that senders only take the lock when they need to:
+		std::atomic<bool> _waiting{false};
+		
+		// Whether any senders may be waiting for space, so that receivers only take the lock when they need to:
+		std::atomic<bool> _sending{false};
+		
+		Spinlock _lock;
+		Waiters _receivers;
+		
+		// Senders run by a scheduler:
+		Waiters _senders;
+		
+		// Senders run by a reactor, in the order they started waiting:
+		Link _posted;
+		
+		// Any other senders, which block their thread:
+		std::condition_variable_any _blocked;
+		std::size_t _blocking = 0;
+	};
+}
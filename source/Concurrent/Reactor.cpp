@@ -0,0 +1,376 @@
+//
+//  Reactor.cpp
+//  File file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Reactor.hpp"
+#include "Loop.hpp"
+#include "Fiber.hpp"
+
+#if defined(__linux__)
+
+#include <unistd.h>
+#include <errno.h>
+#include <sys/eventfd.h>
+
+#include <cstdint>
+
+#include <system_error>
+
+namespace Concurrent
+{
+	constexpr std::size_t Reactor::DEFAULT_MAXIMUM_EVENTS;
+	
+	thread_local Reactor * Reactor::_current = nullptr;
+	
+	Reactor::Reactor(std::size_t maximum_events) : _previous(_current), _wheel(Timer::Wheel::local()), _events(maximum_events)
+	{
+		_descriptor = ::epoll_create1(EPOLL_CLOEXEC);
+		
+		if (_descriptor == -1) {
+			throw std::system_error(errno, std::generic_category(), "epoll_create1(...)");
+		}
+		
+		_doorbell = ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+		
+		if (_doorbell == -1) {
+			auto error = errno;
+			::close(_descriptor);
+			
+			throw std::system_error(error, std::generic_category(), "eventfd(...)");
+		}
+		
+		// Records are never null, so a null pointer identifies the doorbell:
+		epoll_event event = {};
+		event.events = EPOLLIN;
+		event.data.ptr = nullptr;
+		
+		if (::epoll_ctl(_descriptor, EPOLL_CTL_ADD, _doorbell, &event) == -1) {
+			auto error = errno;
+			::close(_doorbell);
+			::close(_descriptor);
+			
+			throw std::system_error(error, std::generic_category(), "epoll_ctl(...)");
+		}
+		
+		_current = this;
+	}
+	
+	Reactor * Reactor::current() noexcept
+	{
+		return _current;
+	}
+	
+	Reactor::~Reactor()
+	{
+		_current = _previous;
+		
+		// Stop any waiting fibers before the descriptor goes away:
+		_records.clear();
+		
+		::close(_doorbell);
+		::close(_descriptor);
+	}
+	
+	void Reactor::post(Task & task)
+	{
+		auto head = _inbox.load(std::memory_order_relaxed);
+		
+		do {
+			task.next = head;
+		} while (!_inbox.compare_exchange_weak(head, &task, std::memory_order_release, std::memory_order_relaxed));
+		
+		// If the inbox wasn't empty, the reactor has already been woken, and will take this task along with the others:
+		if (head == nullptr) ring();
+	}
+	
+	void Reactor::flush()
+	{
+		receive();
+	}
+	
+	bool Reactor::suspend()
+	{
+		_count += 1;
+		
+		bool resumed;
+		
+		try {
+			resumed = Fiber::current->yield();
+		} catch (...) {
+			_count -= 1;
+			throw;
+		}
+		
+		_count -= 1;
+		
+		return resumed;
+	}
+	
+	namespace
+	{
+		// Posts a migrating fiber to the reactor it is entering, once it has left its previous thread. It is stored on the fiber's stack, until the fiber is resumed.
+		struct Arrival : public Reactor::Task, public Fiber::Handoff
+		{
+			Reactor * reactor = nullptr;
+			Fiber * fiber = nullptr;
+		};
+	}
+	
+	bool Reactor::enter()
+	{
+		auto fiber = Fiber::current;
+		
+		if (_current == this) return !fiber->stop_requested();
+		
+		Arrival arrival;
+		arrival.reactor = this;
+		arrival.fiber = fiber;
+		
+		arrival.Handoff::invoke = [](Fiber::Handoff & handoff, Fiber &) {
+			auto & arrival = static_cast<Arrival &>(handoff);
+			
+			arrival.reactor->post(arrival);
+		};
+		
+		arrival.Task::invoke = [](Task & task) {
+			auto fiber = static_cast<Arrival &>(task).fiber;
+			
+			fiber->schedule();
+		};
+		
+		return fiber->migrate(arrival);
+	}
+	
+	void Reactor::receive()
+	{
+		std::uint64_t value;
+		
+		// Reset the doorbell before emptying the inbox, so that a post which finds it empty afterwards rings again:
+		while (::read(_doorbell, &value, sizeof(value)) == -1 && errno == EINTR) {
+		}
+		
+		auto task = _inbox.exchange(nullptr, std::memory_order_acquire);
+		
+		// Reverse the tasks into the order they were posted, and append them to any which haven't been run yet:
+		Task * received = nullptr;
+		
+		while (task) {
+			auto next = task->next;
+			task->next = received;
+			received = task;
+			task = next;
+		}
+		
+		if (_received) {
+			auto last = _received;
+			while (last->next) last = last->next;
+			
+			last->next = received;
+		} else {
+			_received = received;
+		}
+		
+		try {
+			while (_received) {
+				auto task = _received;
+				_received = task->next;
+				
+				// The task may be destroyed once it has been invoked:
+				task->invoke(*task);
+			}
+		} catch (...) {
+			// The remaining tasks are run by the next update:
+			if (_received) ring();
+			
+			throw;
+		}
+	}
+	
+	void Reactor::ring()
+	{
+		std::uint64_t value = 1;
+		
+		_wakeups.fetch_add(1, std::memory_order_relaxed);
+		
+		// The counter can only overflow after billions of posts without an update, in which case the reactor is already awake:
+		while (::write(_doorbell, &value, sizeof(value)) == -1 && errno == EINTR) {
+		}
+	}
+	
+	Reactor::Record & Reactor::record(int descriptor)
+	{
+		if (std::size_t(descriptor) >= _records.size()) {
+			_records.resize(descriptor + 1);
+		}
+		
+		auto & record = _records[descriptor];
+		
+		if (!record) {
+			record.reset(new Record);
+		}
+		
+		if (!record->registered) {
+			epoll_event event = {};
+			event.events = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET;
+			event.data.ptr = record.get();
+			
+			if (::epoll_ctl(_descriptor, EPOLL_CTL_ADD, descriptor, &event) == -1) {
+				throw std::system_error(errno, std::generic_category(), "epoll_ctl(...)");
+			}
+			
+			record->registered = true;
+		}
+		
+		return *record;
+	}
+	
+	bool Reactor::wait(Condition & condition)
+	{
+		_count += 1;
+		
+		bool woken;
+		
+		try {
+			woken = condition.wait();
+		} catch (...) {
+			_count -= 1;
+			throw;
+		}
+		
+		_count -= 1;
+		
+		return woken;
+	}
+	
+	bool Reactor::wait_readable(int descriptor)
+	{
+		auto & record = this->record(descriptor);
+		
+		if (record.readable) {
+			record.readable = false;
+			
+			return true;
+		}
+		
+		return wait(record.read);
+	}
+	
+	bool Reactor::wait_writable(int descriptor)
+	{
+		auto & record = this->record(descriptor);
+		
+		if (record.writable) {
+			record.writable = false;
+			
+			return true;
+		}
+		
+		return wait(record.write);
+	}
+	
+	void Reactor::remove(int descriptor)
+	{
+		if (std::size_t(descriptor) >= _records.size()) return;
+		
+		auto & record = _records[descriptor];
+		
+		if (!record) return;
+		
+		if (record->registered) {
+			::epoll_ctl(_descriptor, EPOLL_CTL_DEL, descriptor, nullptr);
+		}
+		
+		// Events for this record may still be pending in the current batch, so it can't be destroyed until the batch has been processed:
+		_retired.push_back(std::move(record));
+		
+		if (!_updating) {
+			// Any waiting fibers are stopped when the conditions are destroyed:
+			_retired.clear();
+		}
+	}
+	
+	void Reactor::dispatch(const epoll_event & event)
+	{
+		auto record = reinterpret_cast<Record *>(event.data.ptr);
+		
+		if (record == nullptr) {
+			return receive();
+		}
+		
+		if (event.events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR)) {
+			if (record->read.count()) {
+				record->read.resume();
+			} else {
+				record->readable = true;
+			}
+		}
+		
+		if (event.events & (EPOLLOUT | EPOLLHUP | EPOLLERR)) {
+			if (record->write.count()) {
+				record->write.resume();
+			} else {
+				record->writable = true;
+			}
+		}
+	}
+	
+	std::size_t Reactor::update(int timeout)
+	{
+		auto deadline = _wheel.timeout();
+		
+		if (deadline != Timer::Clock::duration::max()) {
+			// Round up, otherwise we would wake up just before the timer expires:
+			auto milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(deadline + std::chrono::milliseconds(1) - Timer::Clock::duration(1)).count();
+			
+			if (timeout < 0 || milliseconds < timeout) {
+				timeout = milliseconds;
+			}
+		}
+		
+		auto count = ::epoll_wait(_descriptor, _events.data(), _events.size(), timeout);
+		
+		if (count == -1) {
+			if (errno != EINTR) {
+				throw std::system_error(errno, std::generic_category(), "epoll_wait(...)");
+			}
+			
+			count = 0;
+		}
+		
+		_updating = true;
+		
+		try {
+			for (int index = 0; index < count; index += 1) {
+				dispatch(_events[index]);
+			}
+		} catch (...) {
+			_updating = false;
+			_retired.clear();
+			
+			throw;
+		}
+		
+		_updating = false;
+		_retired.clear();
+		
+		count += _wheel.update();
+		
+		// Fibers woken above are only queued if this thread has a loop:
+		if (auto loop = Loop::current()) loop->run();
+		
+		return count;
+	}
+	
+	void Reactor::run()
+	{
+		while (_count > 0 || _wheel.count() > 0) {
+			update();
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,135 @@
+//
+//  Reactor.hpp
+//  File file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Condition.hpp"
+#include "Timer.hpp"
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/epoll.h>
+#endif
+
+namespace Concurrent
+{
+#if defined(__linux__)
+	// An event loop which suspends fibers until file descriptors are ready. Descriptors are registered edge-triggered the first time they are waited on, and stay registered until removed, so waiting doesn't require a system call. A reactor belongs to the thread which runs it.
+	class Reactor
+	{
+	public:
+		static constexpr std::size_t DEFAULT_MAXIMUM_EVENTS = 256;
+		
+		/// The reactor becomes the current reactor of this thread, until it is destroyed.
+		Reactor(std::size_t maximum_events = DEFAULT_MAXIMUM_EVENTS);
+		
+		// Any fibers still waiting will be stopped.
+		~Reactor();
+		
+		/// The reactor of the current thread, if any. This isn't inline, so that a fiber which has moved to another thread doesn't see a value cached from before it moved.
+		static Reactor * current() noexcept;
+		
+		// Work which another thread hands to the reactor, to be run on the reactor's thread. It is linked into the reactor from wherever the other thread allocated it, so posting doesn't allocate.
+		struct Task
+		{
+			Task * next = nullptr;
+			void (*invoke)(Task & task) = nullptr;
+		};
+		
+		/// Run the task on the reactor's thread during the next update, waking the reactor if it is waiting for events. This can be called from any thread, doesn't take a lock, and the task must not be used by the caller afterwards. Only a post which finds the inbox empty writes to the doorbell, so a burst of posts costs a single system call.
+		void post(Task & task);
+		
+		/// Run any tasks which have been posted, without waiting for events. This must be called on the reactor's thread.
+		void flush();
+		
+		/// The number of times the doorbell has been rung, i.e. the number of system calls made by posting threads.
+		std::size_t wakeups() const noexcept {return _wakeups.load(std::memory_order_relaxed);}
+		
+		/// Suspend the current fiber until it is resumed by a posted task. The reactor keeps running while any fibers are suspended this way.
+		/// @returns false if the fiber has been asked to stop.
+		bool suspend();
+		
+		/// Move the current fiber to the reactor's thread, where it is resumed during the reactor's next update. This can be called from any thread, e.g. to rebalance long lived connections, and the reactor's thread must keep updating until the fiber arrives. Descriptors the fiber waits on should be removed from the reactor it is leaving beforehand, and are registered with this reactor when it next waits on them.
+		/// @returns false if the fiber has been asked to stop.
+		bool enter();
+		
+		Reactor(const Reactor & other) = delete;
+		Reactor & operator=(const Reactor & other) = delete;
+		
+		/// Suspend the current fiber until the descriptor is readable, or has been closed by the remote end.
+		/// @returns false if the fiber has been asked to stop.
+		bool wait_readable(int descriptor);
+		
+		/// Suspend the current fiber until the descriptor is writable.
+		/// @returns false if the fiber has been asked to stop.
+		bool wait_writable(int descriptor);
+		
+		/// Deregister the descriptor, which must be done before it is closed, as the number may be reused. Any fibers waiting on it are stopped.
+		void remove(int descriptor);
+		
+		/// Wait up to timeout milliseconds (or indefinitely if negative) for events, and resume the fibers waiting on them. The wait is shortened to the next deadline of the thread's timer wheel, which is updated afterwards. If the thread has a Loop, it is run last.
+		/// @returns the number of events and timers which were processed.
+		std::size_t update(int timeout = -1);
+		
+		/// Process events until there are no more fibers waiting on descriptors or timers.
+		void run();
+		
+		/// The number of fibers waiting on descriptors.
+		std::size_t count() const noexcept {return _count;}
+		
+	private:
+		struct Record
+		{
+			bool registered = false;
+			
+			// An edge which arrived while no fiber was waiting for it:
+			bool readable = false;
+			bool writable = false;
+			
+			Condition read, write;
+		};
+		
+		Record & record(int descriptor);
+		bool wait(Condition & condition);
+		void dispatch(const epoll_event & event);
+		
+		// Run the tasks posted by other threads, in the order they were posted.
+		void receive();
+		
+		// Wake the reactor if it is waiting for events.
+		void ring();
+		
+		thread_local static Reactor * _current;
+		Reactor * _previous;
+		
+		int _descriptor = -1;
+		
+		// An eventfd which other threads write to after posting tasks:
+		int _doorbell = -1;
+		
+		// A lock-free stack of the tasks posted by other threads, most recent first:
+		std::atomic<Task *> _inbox{nullptr};
+		std::atomic<std::size_t> _wakeups{0};
+		
+		// Tasks taken from the inbox which haven't been run yet, oldest first, e.g. because an earlier task raised an exception:
+		Task * _received = nullptr;
+		
+		Timer::Wheel & _wheel;
+		
+		std::vector<epoll_event> _events;
+		std::vector<std::unique_ptr<Record>> _records;
+		std::vector<std::unique_ptr<Record>> _retired;
+		
+		bool _updating = false;
+		
+		std::size_t _count = 0;
+	};
+#endif
+}
@@ -0,0 +1,163 @@
+//
+//  Registry.cpp
+//  File file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Registry.hpp"
+#include "Fiber.hpp"
+
+#include <memory>
+#include <mutex>
+
+namespace Concurrent
+{
+	// The fibers created by one thread. A fiber may be destroyed by another thread, e.g. if it is run by a scheduler, so the list is locked. Snapshots hold the lock while measuring stack usage, which makes a system call, so it is a mutex rather than a spinlock.
+	struct Shard
+	{
+		std::mutex lock;
+		Link nodes;
+		std::size_t count = 0;
+	};
+	
+	namespace
+	{
+		std::atomic<bool> enabled{false};
+		
+		// Shards are kept once their threads exit, as fibers they created may still exist:
+		std::mutex shards_lock;
+		std::vector<std::unique_ptr<Shard>> shards;
+		
+		thread_local Shard * current_shard = nullptr;
+		
+		Shard & shard()
+		{
+			if (current_shard == nullptr) {
+				std::lock_guard<std::mutex> lock(shards_lock);
+				
+				shards.emplace_back(new Shard);
+				current_shard = shards.back().get();
+			}
+			
+			return *current_shard;
+		}
+		
+		std::uint64_t now() noexcept
+		{
+			return std::chrono::duration_cast<std::chrono::nanoseconds>(Timer::Clock::now().time_since_epoch()).count();
+		}
+	}
+	
+	Registry::Node::Node(Fiber * fiber) noexcept : _fiber(fiber)
+	{
+		if (!Concurrent::enabled.load(std::memory_order_relaxed)) return;
+		if (fiber->status() == Status::MAIN) return;
+		
+		_shard = &shard();
+		_changed = now();
+		
+		std::lock_guard<std::mutex> lock(_shard->lock);
+		
+		_shard->nodes.push_back(*this);
+		_shard->count += 1;
+	}
+	
+	Registry::Node::~Node()
+	{
+		unregister();
+	}
+	
+	void Registry::Node::unregister() noexcept
+	{
+		if (_shard) {
+			std::lock_guard<std::mutex> lock(_shard->lock);
+			
+			unlink();
+			_shard->count -= 1;
+		}
+		
+		_shard = nullptr;
+	}
+	
+	void Registry::Node::account(Node & from, Node & to) noexcept
+	{
+		auto time = now();
+		
+		if (from._shard) {
+			from._running.store(from._running.load(std::memory_order_relaxed) + (time - from._changed), std::memory_order_relaxed);
+			from._changed = time;
+		}
+		
+		if (to._shard) {
+			to._switches.store(to._switches.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+			to._waiting.store(to._waiting.load(std::memory_order_relaxed) + (time - to._changed), std::memory_order_relaxed);
+			to._changed = time;
+		}
+	}
+	
+	void Registry::enable() noexcept
+	{
+		Concurrent::enabled.store(true, std::memory_order_relaxed);
+	}
+	
+	void Registry::disable() noexcept
+	{
+		Concurrent::enabled.store(false, std::memory_order_relaxed);
+	}
+	
+	bool Registry::enabled() noexcept
+	{
+		return Concurrent::enabled.load(std::memory_order_relaxed);
+	}
+	
+	std::vector<Registry::Entry> Registry::snapshot(bool stack_usage)
+	{
+		std::vector<Entry> entries;
+		
+		std::lock_guard<std::mutex> lock(shards_lock);
+		
+		for (auto & shard : shards) {
+			// A fiber can't be destroyed while it is linked into its shard, so its stack can be measured:
+			std::lock_guard<std::mutex> lock(shard->lock);
+			
+			for (auto link = shard->nodes.next; link != &shard->nodes; link = link->next) {
+				auto & node = *static_cast<Node *>(link);
+				auto fiber = node._fiber;
+				
+				Entry entry;
+				entry.fiber = fiber;
+				entry.status = fiber->status();
+				entry.annotation = fiber->annotation();
+				entry.scheduler = fiber->scheduler();
+				
+				entry.switches = node._switches.load(std::memory_order_relaxed);
+				entry.running = std::chrono::nanoseconds(node._running.load(std::memory_order_relaxed));
+				entry.waiting = std::chrono::nanoseconds(node._waiting.load(std::memory_order_relaxed));
+				
+				if (stack_usage) entry.stack_used = fiber->stack().used();
+				entry.stack_size = fiber->stack().allocated_size();
+				
+				entries.push_back(std::move(entry));
+			}
+		}
+		
+		return entries;
+	}
+	
+	std::size_t Registry::count()
+	{
+		std::size_t count = 0;
+		
+		std::lock_guard<std::mutex> lock(shards_lock);
+		
+		for (auto & shard : shards) {
+			std::lock_guard<std::mutex> lock(shard->lock);
+			
+			count += shard->count;
+		}
+		
+		return count;
+	}
+}
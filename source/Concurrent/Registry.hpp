@@ -0,0 +1,102 @@
+//
+//  Registry.hpp
+//  File file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Link.hpp"
+#include "Timer.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Concurrent
+{
+	class Fiber;
+	class Scheduler;
+	enum class Status;
+	
+	// An opt-in list of live fibers, which accounts for the time each spends running and suspended, so that the few fibers which hog a thread can be found at runtime. Fibers created while the registry is enabled are linked into a list belonging to the thread which created them, so registering doesn't contend between threads, and each switch to or from a registered fiber reads the clock once.
+	class Registry
+	{
+	public:
+		// Embedded in each fiber, and linked into the registry if it was enabled when the fiber was created. The main fiber of each thread is never registered.
+		class Node : public Link
+		{
+		public:
+			Node(Fiber * fiber) noexcept;
+			~Node();
+			
+			Node(const Node & other) = delete;
+			Node & operator=(const Node & other) = delete;
+			
+			bool registered() const noexcept {return _shard != nullptr;}
+			
+			/// Remove the fiber from the registry, e.g. before its stack is released.
+			void unregister() noexcept;
+			
+			/// Account for the current thread switching from one fiber to another.
+			static void switched(Node & from, Node & to) noexcept
+			{
+				if (from._shard || to._shard) account(from, to);
+			}
+			
+		private:
+			static void account(Node & from, Node & to) noexcept;
+			
+			Fiber * _fiber;
+			
+			struct Shard * _shard = nullptr;
+			
+			// Written by the thread running the fiber, and read by any thread taking a snapshot:
+			std::atomic<std::uint64_t> _switches{0};
+			std::atomic<std::uint64_t> _running{0};
+			std::atomic<std::uint64_t> _waiting{0};
+			
+			// When the fiber last started or stopped running, in nanoseconds:
+			std::uint64_t _changed = 0;
+			
+			friend class Registry;
+		};
+		
+		/// Register fibers which are created from now on. Fibers which already exist aren't registered.
+		static void enable() noexcept;
+		
+		/// Stop registering new fibers. Fibers which are already registered stay registered until they are destroyed.
+		static void disable() noexcept;
+		
+		static bool enabled() noexcept;
+		
+		struct Entry
+		{
+			const Fiber * fiber = nullptr;
+			Status status;
+			std::string annotation;
+			
+			const Scheduler * scheduler = nullptr;
+			
+			// The number of times the fiber has been resumed:
+			std::uint64_t switches = 0;
+			
+			// The total time the fiber has spent running, excluding any slice which is still in progress, and suspended, including time spent ready but not yet resumed:
+			Timer::Clock::duration running = Timer::Clock::duration::zero();
+			Timer::Clock::duration waiting = Timer::Clock::duration::zero();
+			
+			// The bytes of the fiber's stack which have been touched, and the size of the stack:
+			std::size_t stack_used = 0;
+			std::size_t stack_size = 0;
+		};
+		
+		/// Describe every registered fiber which hasn't been destroyed, on all threads. The status of a fiber which is running on another thread may already be out of date. Measuring stack usage takes a system call per fiber, so it can be skipped.
+		static std::vector<Entry> snapshot(bool stack_usage = true);
+		
+		/// The number of registered fibers which haven't been destroyed.
+		static std::size_t count();
+	};
+}
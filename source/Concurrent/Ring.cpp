@@ -0,0 +1,524 @@
+//
+//  Ring.cpp
+//  File file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Ring.hpp"
+#include "Fiber.hpp"
+
+#include <unistd.h>
+#include <errno.h>
+#include <string.h>
+
+#include <sys/mman.h>
+#include <sys/uio.h>
+
+#include <system_error>
+#include <stdexcept>
+#include <algorithm>
+
+#if defined(CONCURRENT_IO_URING)
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#endif
+
+namespace Concurrent
+{
+	constexpr std::size_t Ring::DEFAULT_ENTRIES;
+	
+	static std::size_t check(ssize_t result, const char * operation)
+	{
+		if (result < 0) {
+			throw std::system_error(errno, std::generic_category(), operation);
+		}
+		
+		return result;
+	}
+	
+	Ring::Ring(std::size_t entries, std::size_t buffer_count, std::size_t buffer_size)
+	{
+		setup(entries);
+		
+		if (buffer_count) {
+			try {
+				allocate_buffers(buffer_count, buffer_size);
+			} catch (...) {
+				if (_buffer_memory) ::munmap(_buffer_memory, _buffer_memory_size);
+				teardown();
+				
+				throw;
+			}
+		}
+	}
+	
+	void Ring::allocate_buffers(std::size_t buffer_count, std::size_t buffer_size)
+	{
+		_buffer_memory_size = buffer_count * buffer_size;
+		_buffer_memory = ::mmap(nullptr, _buffer_memory_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		
+		if (_buffer_memory == MAP_FAILED) {
+			_buffer_memory = nullptr;
+			
+			throw std::system_error(errno, std::generic_category(), "mmap(...)");
+		}
+		
+		std::vector<iovec> vectors(buffer_count);
+		
+		for (std::size_t index = 0; index < buffer_count; index += 1) {
+			vectors[index].iov_base = (unsigned char *)_buffer_memory + index * buffer_size;
+			vectors[index].iov_len = buffer_size;
+		}
+		
+		// Buffers are handed out from the back, so the lowest index is used first:
+		for (std::size_t index = buffer_count; index > 0; index -= 1) {
+			_buffers.push_back(Buffer{vectors[index-1].iov_base, buffer_size, unsigned(index-1)});
+		}
+		
+#if defined(CONCURRENT_IO_URING)
+		if (available()) {
+			// This can fail if the memory lock limit is too low, in which case the buffers are used like any other memory:
+			_buffers_registered = ::syscall(__NR_io_uring_register, _descriptor, IORING_REGISTER_BUFFERS, vectors.data(), vectors.size()) == 0;
+		}
+#endif
+	}
+	
+	Ring::Buffer Ring::acquire()
+	{
+		if (_buffers.empty()) {
+			throw std::runtime_error("No fixed buffers available!");
+		}
+		
+		auto buffer = _buffers.back();
+		_buffers.pop_back();
+		
+		return buffer;
+	}
+	
+	void Ring::release(const Buffer & buffer)
+	{
+		_buffers.push_back(buffer);
+	}
+	
+	void Ring::run()
+	{
+		while (_count > 0) {
+			update();
+		}
+	}
+	
+#if defined(CONCURRENT_IO_URING)
+	// The user data of requests which don't have a slot, e.g. cancellations:
+	static const std::uint64_t DETACHED = UINT64_MAX;
+	
+	void Ring::setup(std::size_t entries)
+	{
+		io_uring_params parameters;
+		memset(&parameters, 0, sizeof(parameters));
+		
+		auto descriptor = ::syscall(__NR_io_uring_setup, entries, &parameters);
+		
+		// io_uring may be unavailable, e.g. an older kernel or disabled by seccomp, so we fall back to system calls:
+		if (descriptor == -1) return;
+		
+		_descriptor = descriptor;
+		
+		_submission_ring_size = parameters.sq_off.array + parameters.sq_entries * sizeof(unsigned);
+		_completion_ring_size = parameters.cq_off.cqes + parameters.cq_entries * sizeof(io_uring_cqe);
+		
+		bool single_mapping = parameters.features & IORING_FEAT_SINGLE_MMAP;
+		
+		if (single_mapping) {
+			_submission_ring_size = _completion_ring_size = std::max(_submission_ring_size, _completion_ring_size);
+		}
+		
+		_submission_ring = ::mmap(nullptr, _submission_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _descriptor, IORING_OFF_SQ_RING);
+		
+		if (_submission_ring == MAP_FAILED) {
+			auto error = errno;
+			
+			_submission_ring = nullptr;
+			teardown();
+			
+			throw std::system_error(error, std::generic_category(), "mmap(...)");
+		}
+		
+		if (single_mapping) {
+			_completion_ring = _submission_ring;
+		} else {
+			_completion_ring = ::mmap(nullptr, _completion_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _descriptor, IORING_OFF_CQ_RING);
+			
+			if (_completion_ring == MAP_FAILED) {
+				auto error = errno;
+				
+				_completion_ring = nullptr;
+				teardown();
+				
+				throw std::system_error(error, std::generic_category(), "mmap(...)");
+			}
+		}
+		
+		_requests_size = parameters.sq_entries * sizeof(io_uring_sqe);
+		_requests = (io_uring_sqe *)::mmap(nullptr, _requests_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _descriptor, IORING_OFF_SQES);
+		
+		if (_requests == MAP_FAILED) {
+			auto error = errno;
+			
+			_requests = nullptr;
+			teardown();
+			
+			throw std::system_error(error, std::generic_category(), "mmap(...)");
+		}
+		
+		auto submission = (unsigned char *)_submission_ring;
+		_submission_head = (unsigned *)(submission + parameters.sq_off.head);
+		_submission_tail = (unsigned *)(submission + parameters.sq_off.tail);
+		_submission_mask = (unsigned *)(submission + parameters.sq_off.ring_mask);
+		_submission_array = (unsigned *)(submission + parameters.sq_off.array);
+		_submission_entries = parameters.sq_entries;
+		
+		auto completion = (unsigned char *)_completion_ring;
+		_completion_head = (unsigned *)(completion + parameters.cq_off.head);
+		_completion_tail = (unsigned *)(completion + parameters.cq_off.tail);
+		_completion_mask = (unsigned *)(completion + parameters.cq_off.ring_mask);
+		_completions = (io_uring_cqe *)(completion + parameters.cq_off.cqes);
+		
+		_slots.reserve(parameters.cq_entries);
+		_free.reserve(parameters.cq_entries);
+		_ready.reserve(parameters.cq_entries);
+	}
+	
+	void Ring::teardown() noexcept
+	{
+		if (_requests) ::munmap(_requests, _requests_size);
+		if (_completion_ring && _completion_ring != _submission_ring) ::munmap(_completion_ring, _completion_ring_size);
+		if (_submission_ring) ::munmap(_submission_ring, _submission_ring_size);
+		
+		_requests = nullptr;
+		_completion_ring = _submission_ring = nullptr;
+		
+		if (_descriptor != -1) {
+			::close(_descriptor);
+			_descriptor = -1;
+		}
+	}
+	
+	Ring::~Ring()
+	{
+		// Stopping a fiber cancels its operation, which requires the ring:
+		for (std::size_t index = 0; index < _slots.size(); index += 1) {
+			if (auto fiber = _slots[index].fiber) {
+				fiber->stop();
+			}
+		}
+		
+		// The stopped fibers wait for their operations to complete, so they can unwind:
+		try {
+			run();
+		} catch (...) {
+			// The fibers which were stopped raise Stop, which doesn't escape them, but any other fiber resumed by the ring might fail.
+		}
+		
+		teardown();
+		
+		if (_buffer_memory) ::munmap(_buffer_memory, _buffer_memory_size);
+	}
+	
+	io_uring_sqe * Ring::prepare(std::uint8_t opcode, int descriptor)
+	{
+		auto tail = *_submission_tail;
+		
+		// If the submission queue is full, submit the queued requests to make space:
+		if (tail - __atomic_load_n(_submission_head, __ATOMIC_ACQUIRE) >= _submission_entries) {
+			submit(0);
+		}
+		
+		auto index = tail & *_submission_mask;
+		auto request = &_requests[index];
+		
+		memset(request, 0, sizeof(*request));
+		request->opcode = opcode;
+		request->fd = descriptor;
+		
+		_submission_array[index] = index;
+		
+		return request;
+	}
+	
+	void Ring::submit(unsigned minimum_completions)
+	{
+		while (_queued || minimum_completions) {
+			auto result = ::syscall(__NR_io_uring_enter, _descriptor, _queued, minimum_completions, minimum_completions ? IORING_ENTER_GETEVENTS : 0, nullptr, 0);
+			
+			if (result == -1) {
+				if (errno == EINTR) continue;
+				
+				throw std::system_error(errno, std::generic_category(), "io_uring_enter(...)");
+			}
+			
+			_queued -= result;
+			
+			break;
+		}
+	}
+	
+	int Ring::complete(io_uring_sqe * request)
+	{
+		auto fiber = Fiber::current;
+		std::uint32_t index;
+		
+		if (_free.empty()) {
+			index = _slots.size();
+			_slots.emplace_back();
+		} else {
+			index = _free.back();
+			_free.pop_back();
+		}
+		
+		_slots[index].fiber = fiber;
+		_slots[index].completed = false;
+		
+		request->user_data = index;
+		
+		// Make the request visible to the kernel. It will be submitted with the next batch:
+		__atomic_store_n(_submission_tail, *_submission_tail + 1, __ATOMIC_RELEASE);
+		_queued += 1;
+		_count += 1;
+		
+		try {
+			fiber->yield();
+			
+			if (!_slots[index].completed) throw Stop();
+		} catch (...) {
+			if (!_slots[index].completed) {
+				auto cancellation = prepare(IORING_OP_ASYNC_CANCEL, -1);
+				cancellation->addr = index;
+				cancellation->user_data = DETACHED;
+				__atomic_store_n(_submission_tail, *_submission_tail + 1, __ATOMIC_RELEASE);
+				_queued += 1;
+				
+				// The kernel may write into the operation's buffers, which are often on the fiber's stack, until the operation completes, usually with ECANCELED, so the fiber can't be unwound before then:
+				while (!_slots[index].completed) {
+					try {
+						fiber->yield();
+					} catch (Stop) {
+					}
+				}
+			}
+			
+			_slots[index].fiber = nullptr;
+			_free.push_back(index);
+			
+			throw;
+		}
+		
+		auto result = _slots[index].result;
+		
+		_slots[index].fiber = nullptr;
+		_free.push_back(index);
+		
+		if (result < 0) {
+			throw std::system_error(-result, std::generic_category(), "io_uring(...)");
+		}
+		
+		return result;
+	}
+	
+	std::size_t Ring::reap()
+	{
+		auto head = *_completion_head;
+		auto tail = __atomic_load_n(_completion_tail, __ATOMIC_ACQUIRE);
+		std::size_t count = 0;
+		
+		for (; head != tail; head += 1) {
+			auto & completion = _completions[head & *_completion_mask];
+			
+			if (completion.user_data == DETACHED) continue;
+			
+			auto index = completion.user_data;
+			auto & slot = _slots[index];
+			
+			slot.result = completion.res;
+			slot.completed = true;
+			_count -= 1;
+			count += 1;
+			
+			_ready.push_back(slot.fiber);
+		}
+		
+		// Release the completion queue entries before resuming fibers, which may submit more requests:
+		__atomic_store_n(_completion_head, head, __ATOMIC_RELEASE);
+		
+		std::vector<Fiber *> ready;
+		ready.swap(_ready);
+		
+		std::exception_ptr exception;
+		
+		for (auto fiber : ready) {
+			try {
+				fiber->resume();
+			} catch (...) {
+				if (!exception) exception = std::current_exception();
+			}
+		}
+		
+		// Keep the capacity for the next batch:
+		ready.clear();
+		if (_ready.empty()) _ready.swap(ready);
+		
+		if (exception) std::rethrow_exception(exception);
+		
+		return count;
+	}
+	
+	std::size_t Ring::update(bool wait)
+	{
+		if (!available()) return 0;
+		
+		auto pending = *_completion_head != __atomic_load_n(_completion_tail, __ATOMIC_ACQUIRE);
+		
+		submit(wait && _count > 0 && !pending ? 1 : 0);
+		
+		return reap();
+	}
+	
+	std::size_t Ring::read(int descriptor, void * data, std::size_t size, off_t offset)
+	{
+		if (!available()) {
+			return check(offset < 0 ? ::read(descriptor, data, size) : ::pread(descriptor, data, size, offset), "read(...)");
+		}
+		
+		auto request = prepare(IORING_OP_READ, descriptor);
+		request->addr = (std::uint64_t)data;
+		request->len = size;
+		request->off = offset;
+		
+		return complete(request);
+	}
+	
+	std::size_t Ring::write(int descriptor, const void * data, std::size_t size, off_t offset)
+	{
+		if (!available()) {
+			return check(offset < 0 ? ::write(descriptor, data, size) : ::pwrite(descriptor, data, size, offset), "write(...)");
+		}
+		
+		auto request = prepare(IORING_OP_WRITE, descriptor);
+		request->addr = (std::uint64_t)data;
+		request->len = size;
+		request->off = offset;
+		
+		return complete(request);
+	}
+	
+	std::size_t Ring::read_fixed(int descriptor, Buffer & buffer, std::size_t size, off_t offset)
+	{
+		if (!_buffers_registered) {
+			return read(descriptor, buffer.data, size, offset);
+		}
+		
+		auto request = prepare(IORING_OP_READ_FIXED, descriptor);
+		request->addr = (std::uint64_t)buffer.data;
+		request->len = size;
+		request->off = offset;
+		request->buf_index = buffer.index;
+		
+		return complete(request);
+	}
+	
+	std::size_t Ring::write_fixed(int descriptor, const Buffer & buffer, std::size_t size, off_t offset)
+	{
+		if (!_buffers_registered) {
+			return write(descriptor, buffer.data, size, offset);
+		}
+		
+		auto request = prepare(IORING_OP_WRITE_FIXED, descriptor);
+		request->addr = (std::uint64_t)buffer.data;
+		request->len = size;
+		request->off = offset;
+		request->buf_index = buffer.index;
+		
+		return complete(request);
+	}
+	
+	int Ring::accept(int descriptor, sockaddr * address, socklen_t * length, int flags)
+	{
+		if (!available()) {
+			return check(::accept4(descriptor, address, length, flags), "accept4(...)");
+		}
+		
+		auto request = prepare(IORING_OP_ACCEPT, descriptor);
+		request->addr = (std::uint64_t)address;
+		request->addr2 = (std::uint64_t)length;
+		request->accept_flags = flags;
+		
+		return complete(request);
+	}
+	
+	void Ring::fsync(int descriptor, bool data_only)
+	{
+		if (!available()) {
+			check(data_only ? ::fdatasync(descriptor) : ::fsync(descriptor), "fsync(...)");
+			return;
+		}
+		
+		auto request = prepare(IORING_OP_FSYNC, descriptor);
+		request->fsync_flags = data_only ? IORING_FSYNC_DATASYNC : 0;
+		
+		complete(request);
+	}
+#else
+	void Ring::setup(std::size_t entries)
+	{
+	}
+	
+	void Ring::teardown() noexcept
+	{
+	}
+	
+	Ring::~Ring()
+	{
+		if (_buffer_memory) ::munmap(_buffer_memory, _buffer_memory_size);
+	}
+	
+	std::size_t Ring::update(bool wait)
+	{
+		return 0;
+	}
+	
+	std::size_t Ring::read(int descriptor, void * data, std::size_t size, off_t offset)
+	{
+		return check(offset < 0 ? ::read(descriptor, data, size) : ::pread(descriptor, data, size, offset), "read(...)");
+	}
+	
+	std::size_t Ring::write(int descriptor, const void * data, std::size_t size, off_t offset)
+	{
+		return check(offset < 0 ? ::write(descriptor, data, size) : ::pwrite(descriptor, data, size, offset), "write(...)");
+	}
+	
+	std::size_t Ring::read_fixed(int descriptor, Buffer & buffer, std::size_t size, off_t offset)
+	{
+		return read(descriptor, buffer.data, size, offset);
+	}
+	
+	std::size_t Ring::write_fixed(int descriptor, const Buffer & buffer, std::size_t size, off_t offset)
+	{
+		return write(descriptor, buffer.data, size, offset);
+	}
+	
+	int Ring::accept(int descriptor, sockaddr * address, socklen_t * length, int flags)
+	{
+#if defined(__linux__)
+		return check(::accept4(descriptor, address, length, flags), "accept4(...)");
+#else
+		return check(::accept(descriptor, address, length), "accept(...)");
+#endif
+	}
+	
+	void Ring::fsync(int descriptor, bool data_only)
+	{
+		check(::fsync(descriptor), "fsync(...)");
+	}
+#endif
+}
@@ -0,0 +1,133 @@
+//
+//  Ring.hpp
+//  File file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+#include <sys/types.h>
+#include <sys/socket.h>
+
+#if defined(__linux__) && defined(__has_include)
+	#if __has_include(<linux/io_uring.h>)
+		#define CONCURRENT_IO_URING
+	#endif
+#endif
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+namespace Concurrent
+{
+	class Fiber;
+	
+	// Performs I/O on behalf of fibers using io_uring. Each operation submits a request and suspends the calling fiber, which is resumed with the result once the completion is reaped by update. If the fiber is asked to stop while waiting, the operation is cancelled, and Stop is raised once it has completed, as until then the kernel may still write into the fiber's buffers. A fiber must not be destroyed while it waits for an operation. Requests are submitted in batches by update, and completions are reaped in batches. If io_uring is not available, operations are performed directly using blocking system calls. A ring belongs to the thread which runs it.
+	class Ring
+	{
+	public:
+		static constexpr std::size_t DEFAULT_ENTRIES = 256;
+		
+		// A fixed buffer which is registered with the kernel, so that it does not need to be mapped for every operation.
+		struct Buffer
+		{
+			void * data = nullptr;
+			std::size_t size = 0;
+			unsigned index = 0;
+		};
+		
+		/// @param buffer_count the number of fixed buffers to allocate and register.
+		Ring(std::size_t entries = DEFAULT_ENTRIES, std::size_t buffer_count = 0, std::size_t buffer_size = 0);
+		
+		// Any fibers still waiting will be stopped.
+		~Ring();
+		
+		Ring(const Ring & other) = delete;
+		Ring & operator=(const Ring & other) = delete;
+		
+		/// Whether operations are performed using io_uring, rather than falling back to blocking system calls.
+		bool available() const noexcept {return _descriptor != -1;}
+		
+		/// Read from the descriptor at the given offset, or the current file position if the offset is negative.
+		std::size_t read(int descriptor, void * data, std::size_t size, off_t offset = -1);
+		std::size_t write(int descriptor, const void * data, std::size_t size, off_t offset = -1);
+		
+		/// Read into a fixed buffer, without the kernel having to map the buffer for the operation.
+		std::size_t read_fixed(int descriptor, Buffer & buffer, std::size_t size, off_t offset = -1);
+		std::size_t write_fixed(int descriptor, const Buffer & buffer, std::size_t size, off_t offset = -1);
+		
+		/// @param flags as for accept4, where supported.
+		int accept(int descriptor, sockaddr * address = nullptr, socklen_t * length = nullptr, int flags = 0);
+		void fsync(int descriptor, bool data_only = false);
+		
+		/// Take a fixed buffer from the pool, throwing std::runtime_error if there are none left.
+		Buffer acquire();
+		void release(const Buffer & buffer);
+		
+		/// Submit any queued requests, optionally waiting for at least one completion, and resume the fibers whose operations completed.
+		/// @returns the number of completions which were processed.
+		std::size_t update(bool wait = true);
+		
+		/// Process completions until there are no more operations in flight.
+		void run();
+		
+		/// The number of operations in flight.
+		std::size_t count() const noexcept {return _count;}
+		
+	private:
+		// Tracks an operation in flight. Completions refer to slots by index, and cancellations refer to the operation they cancel by its slot.
+		struct Slot
+		{
+			Fiber * fiber = nullptr;
+			int result = 0;
+			
+			// Whether the fiber was resumed by the completion, rather than by Fiber::request_stop:
+			bool completed = false;
+		};
+		
+		void setup(std::size_t entries);
+		
+		// Unmap the rings and close the descriptor, e.g. if the ring couldn't be set up completely.
+		void teardown() noexcept;
+		void allocate_buffers(std::size_t buffer_count, std::size_t buffer_size);
+		
+		io_uring_sqe * prepare(std::uint8_t opcode, int descriptor);
+		int complete(io_uring_sqe * request);
+		void submit(unsigned minimum_completions);
+		std::size_t reap();
+		
+		int _descriptor = -1;
+		
+		// The submission queue:
+		void * _submission_ring = nullptr;
+		std::size_t _submission_ring_size = 0;
+		unsigned * _submission_head = nullptr, * _submission_tail = nullptr, * _submission_mask = nullptr, * _submission_array = nullptr;
+		unsigned _submission_entries = 0;
+		io_uring_sqe * _requests = nullptr;
+		std::size_t _requests_size = 0;
+		
+		// The completion queue, which may share the submission queue mapping:
+		void * _completion_ring = nullptr;
+		std::size_t _completion_ring_size = 0;
+		unsigned * _completion_head = nullptr, * _completion_tail = nullptr, * _completion_mask = nullptr;
+		io_uring_cqe * _completions = nullptr;
+		
+		// Requests which have been prepared but not yet submitted:
+		unsigned _queued = 0;
+		
+		std::vector<Slot> _slots;
+		std::vector<std::uint32_t> _free;
+		std::vector<Fiber *> _ready;
+		std::size_t _count = 0;
+		
+		void * _buffer_memory = nullptr;
+		std::size_t _buffer_memory_size = 0;
+		std::vector<Buffer> _buffers;
+		bool _buffers_registered = false;
+	};
+}
@@ -0,0 +1,290 @@
+//
+//  Scheduler.cpp
+//  File file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Scheduler.hpp"
+#include "Deque.hpp"
+
+#include <cassert>
+
+namespace Concurrent
+{
+	struct Scheduler::Worker
+	{
+		Worker(Scheduler & scheduler_, std::size_t index_) : scheduler(scheduler_), index(index_) {}
+		
+		Scheduler & scheduler;
+		std::size_t index;
+		
+		Deque<Fiber *> queue;
+		
+		// Stacks of finished fibers, reused by fibers spawned on this worker:
+		std::vector<Stack> stacks;
+		
+		// Set by the current fiber before it switches back to the worker:
+		Spinlock * unlock = nullptr;
+		bool yielding = false;
+		
+		std::size_t ticks = 0;
+		
+		std::thread thread;
+	};
+	
+	thread_local Scheduler::Worker * Scheduler::_current = nullptr;
+	
+	Scheduler::Scheduler(std::size_t concurrency, std::size_t stack_size, const Stack::Options & options) : _stack_size(stack_size), _options(options)
+	{
+		if (concurrency == 0) concurrency = 1;
+		
+		for (std::size_t index = 0; index < concurrency; index += 1) {
+			_workers.emplace_back(new Worker(*this, index));
+		}
+		
+		for (auto & worker : _workers) {
+			worker->thread = std::thread(&Scheduler::run, this, std::ref(*worker));
+		}
+	}
+	
+	Scheduler::~Scheduler()
+	{
+		wait();
+		
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			_stopping = true;
+		}
+		
+		_ready.notify_all();
+		
+		for (auto & worker : _workers) {
+			worker->thread.join();
+		}
+	}
+	
+	Stack Scheduler::acquire(std::size_t stack_size)
+	{
+		auto worker = _current;
+		
+		// Cached stacks have been reset, so their size is the whole stack:
+		if (worker && &worker->scheduler == this && !worker->stacks.empty() && worker->stacks.back().size() >= stack_size) {
+			Stack stack(std::move(worker->stacks.back()));
+			worker->stacks.pop_back();
+			
+			return stack;
+		}
+		
+		return Stack(stack_size, _options);
+	}
+	
+	void Scheduler::schedule(Fiber * fiber)
+	{
+		auto worker = _current;
+		
+		if (worker && &worker->scheduler == this) {
+			worker->queue.push(fiber);
+			
+			notify();
+		} else {
+			inject(fiber);
+		}
+	}
+	
+	void Scheduler::inject(Fiber * fiber)
+	{
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			
+			_injected.push_back(fiber);
+			_pending.fetch_add(1, std::memory_order_relaxed);
+		}
+		
+		_ready.notify_one();
+	}
+	
+	bool Scheduler::extract(Fiber *& fiber)
+	{
+		if (_pending.load(std::memory_order_relaxed) == 0) return false;
+		
+		std::lock_guard<std::mutex> lock(_mutex);
+		
+		if (_injected.empty()) return false;
+		
+		fiber = _injected.front();
+		_injected.pop_front();
+		_pending.fetch_sub(1, std::memory_order_relaxed);
+		
+		return true;
+	}
+	
+	void Scheduler::notify()
+	{
+		// Pairs with the fence in Scheduler::next, so that either the sleeping worker sees the new fiber, or we see the sleeping worker:
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		
+		if (_sleeping.load(std::memory_order_relaxed) > 0) {
+			std::lock_guard<std::mutex> lock(_mutex);
+			_ready.notify_one();
+		}
+	}
+	
+	void Scheduler::wait()
+	{
+		assert(_current == nullptr);
+		
+		std::unique_lock<std::mutex> lock(_mutex);
+		
+		_finished.wait(lock, [&]{
+			return _count.load(std::memory_order_acquire) == 0;
+		});
+	}
+	
+	void Scheduler::finished()
+	{
+		if (_count.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+			std::lock_guard<std::mutex> lock(_mutex);
+			_finished.notify_all();
+		}
+	}
+	
+	bool Scheduler::yield()
+	{
+		auto worker = _current;
+		assert(worker);
+		
+		worker->yielding = true;
+		
+		return Fiber::current->yield();
+	}
+	
+	void Scheduler::suspend(Spinlock & lock)
+	{
+		auto worker = _current;
+		assert(worker);
+		
+		worker->unlock = &lock;
+		
+		Fiber::current->yield();
+	}
+	
+	Fiber * Scheduler::steal(Worker & worker)
+	{
+		Fiber * fiber = nullptr;
+		auto count = _workers.size();
+		
+		for (std::size_t offset = 1; offset < count; offset += 1) {
+			auto & victim = _workers[(worker.index + offset) % count];
+			
+			if (victim->queue.steal(fiber)) return fiber;
+		}
+		
+		return nullptr;
+	}
+	
+	Fiber * Scheduler::next(Worker & worker)
+	{
+		Fiber * fiber = nullptr;
+		
+		// Fibers sleeping on this worker are scheduled by its timer wheel:
+		auto & wheel = Timer::Wheel::local();
+		
+		// Occasionally prefer injected fibers, so that they can't be starved by local work:
+		worker.ticks += 1;
+		if (worker.ticks % 61 == 0 && extract(fiber)) return fiber;
+		
+		while (true) {
+			if (wheel.count()) wheel.update();
+			
+			if (worker.queue.pop(fiber)) return fiber;
+			if (extract(fiber)) return fiber;
+			if ((fiber = steal(worker))) return fiber;
+			
+			std::unique_lock<std::mutex> lock(_mutex);
+			
+			if (!_injected.empty()) {
+				fiber = _injected.front();
+				_injected.pop_front();
+				_pending.fetch_sub(1, std::memory_order_relaxed);
+				
+				return fiber;
+			}
+			
+			if (_stopping) return nullptr;
+			
+			_sleeping.fetch_add(1, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			
+			// Now that we are advertised as sleeping, check again for fibers pushed by other workers:
+			bool idle = true;
+			for (auto & other : _workers) {
+				if (!other->queue.empty()) {
+					idle = false;
+					break;
+				}
+			}
+			
+			if (idle) {
+				auto timeout = wheel.timeout();
+				
+				if (timeout == Timer::Clock::duration::max()) {
+					_ready.wait(lock);
+				} else {
+					_ready.wait_for(lock, timeout);
+				}
+			}
+			
+			_sleeping.fetch_sub(1, std::memory_order_relaxed);
+		}
+	}
+	
+	void Scheduler::execute(Worker & worker, Fiber * fiber)
+	{
+		try {
+			fiber->resume();
+		} catch (...) {
+			// The fiber has finished, so keep the exception for it to report:
+			fiber->_exception = std::current_exception();
+		}
+		
+		if (fiber->_status == Status::FINISHED) {
+			if (_sizing) _sizing->record(*fiber);
+			
+			Stack stack = Fiber::destroy(fiber);
+			
+			if (worker.stacks.size() < Fiber::Pool::DEFAULT_MAXIMUM_STACKS) {
+				stack.reset();
+				
+				// Otherwise the next fiber to use this stack would be measured as using at least as much:
+				if (_sizing) stack.discard();
+				
+				worker.stacks.push_back(std::move(stack));
+			}
+			
+			finished();
+		} else if (worker.yielding) {
+			worker.yielding = false;
+			
+			inject(fiber);
+		}
+		
+		// Once this is released, the fiber may be resumed by another worker:
+		if (auto unlock = worker.unlock) {
+			worker.unlock = nullptr;
+			unlock->unlock();
+		}
+	}
+	
+	void Scheduler::run(Worker & worker)
+	{
+		_current = &worker;
+		
+		while (auto fiber = next(worker)) {
+			execute(worker, fiber);
+		}
+		
+		_current = nullptr;
+	}
+}
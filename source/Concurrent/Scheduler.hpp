@@ -0,0 +1,116 @@
+//
+//  Scheduler.hpp
+//  File file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Fiber.hpp"
+#include "Sizing.hpp"
+#include "Spinlock.hpp"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <vector>
+#include <thread>
+
+namespace Concurrent
+{
+	// Runs fibers on a set of worker threads. Each worker has a local run queue, and idle workers steal fibers from busy ones, so a ready fiber may be resumed on any worker.
+	class Scheduler
+	{
+	public:
+		/// @param options the placement of new stacks. With Stack::Options::LOCAL_NODE, a fiber spawned by a worker has its stack on that worker's node, although it may later be stolen by a worker on another node.
+		Scheduler(std::size_t concurrency = std::thread::hardware_concurrency(), std::size_t stack_size = Fiber::DEFAULT_STACK_SIZE, const Stack::Options & options = Stack::Options());
+		
+		// Waits for all fibers to finish, then stops the worker threads.
+		~Scheduler();
+		
+		Scheduler(const Scheduler & other) = delete;
+		Scheduler & operator=(const Scheduler & other) = delete;
+		
+		/// Create a fiber which will be run by one of the workers. The fiber is owned by the scheduler, and is deleted once it finishes.
+		template <typename FunctionT>
+		void spawn(FunctionT && function)
+		{
+			spawn(nullptr, std::forward<FunctionT>(function));
+		}
+		
+		/// The fiber is emplaced on its stack, so once the workers have cached enough stacks, this doesn't allocate.
+		template <typename FunctionT>
+		void spawn(const char * annotation, FunctionT && function)
+		{
+			auto stack_size = _sizing ? _sizing->stack_size(annotation) : _stack_size;
+			
+			auto fiber = Fiber::emplace(annotation, acquire(stack_size), std::forward<FunctionT>(function));
+			fiber->_scheduler = this;
+			
+			_count.fetch_add(1, std::memory_order_relaxed);
+			
+			schedule(fiber);
+		}
+		
+		/// Make a suspended fiber ready to run. This can be called from any thread.
+		void schedule(Fiber * fiber);
+		
+		/// Block the calling thread until all fibers have finished. This must not be called from within a scheduled fiber.
+		void wait();
+		
+		/// Reschedule the current fiber behind all other ready fibers.
+		/// @returns false if the fiber has been asked to stop.
+		static bool yield();
+		
+		/// Suspend the current fiber, releasing the given lock once it has been switched out. This ensures the fiber can't be resumed by another worker while it is still running.
+		static void suspend(Spinlock & lock);
+		
+		/// Choose the stack size of each spawned fiber from the given sizing, by annotation, and record the stack usage of each fiber when it finishes. This must be called before any fibers are spawned.
+		void track(Sizing * sizing) noexcept {_sizing = sizing;}
+		
+		std::size_t concurrency() const noexcept {return _workers.size();}
+		
+		/// The number of fibers which have not yet finished.
+		std::size_t count() const noexcept {return _count.load(std::memory_order_relaxed);}
+		
+	private:
+		struct Worker;
+		
+		Stack acquire(std::size_t stack_size);
+		
+		thread_local static Worker * _current;
+		
+		void inject(Fiber * fiber);
+		bool extract(Fiber *& fiber);
+		
+		Fiber * next(Worker & worker);
+		Fiber * steal(Worker & worker);
+		void notify();
+		void finished();
+		
+		void run(Worker & worker);
+		void execute(Worker & worker, Fiber * fiber);
+		
+		std::size_t _stack_size;
+		Stack::Options _options;
+		Sizing * _sizing = nullptr;
+		
+		std::vector<std::unique_ptr<Worker>> _workers;
+		
+		// Fibers scheduled from outside the workers, and fibers which yielded:
+		std::mutex _mutex;
+		std::condition_variable _ready;
+		std::deque<Fiber *> _injected;
+		std::atomic<std::size_t> _pending{0};
+		
+		std::atomic<std::size_t> _sleeping{0};
+		bool _stopping = false;
+		
+		std::atomic<std::size_t> _count{0};
+		std::condition_variable _finished;
+	};
+}
@@ -0,0 +1,59 @@
+//
+//  Semaphore.cpp
+//  File file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Semaphore.hpp"
+
+namespace Concurrent
+{
+	void Semaphore::acquire()
+	{
+		_lock.lock();
+		
+		if (_available > 0) {
+			_available -= 1;
+			_lock.unlock();
+			
+			return;
+		}
+		
+		// Once woken, this fiber has been given a unit. If it is stopped before it can run, the unit is passed on:
+		_waiters.wait(_lock, [this]{release();});
+	}
+	
+	bool Semaphore::try_acquire() noexcept
+	{
+		std::lock_guard<Spinlock> lock(_lock);
+		
+		if (_available == 0) return false;
+		
+		_available -= 1;
+		
+		return true;
+	}
+	
+	void Semaphore::release(std::size_t count)
+	{
+		while (count > 0) {
+			_lock.lock();
+			
+			auto waiter = _waiters.pop();
+			
+			if (!waiter) {
+				_available += count;
+				_lock.unlock();
+				
+				return;
+			}
+			
+			_lock.unlock();
+			
+			count -= 1;
+			waiter->schedule();
+		}
+	}
+}
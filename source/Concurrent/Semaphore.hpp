@@ -0,0 +1,53 @@
+//
+//  Semaphore.hpp
+//  File file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Waiters.hpp"
+
+namespace Concurrent
+{
+	// A counting semaphore which suspends the current fiber until a unit is available. Released units are handed directly to waiting fibers in the order they started waiting.
+	class Semaphore
+	{
+	public:
+		explicit Semaphore(std::size_t available = 0) noexcept : _available(available) {}
+		
+		Semaphore(const Semaphore & other) = delete;
+		Semaphore & operator=(const Semaphore & other) = delete;
+		
+		void acquire();
+		bool try_acquire() noexcept;
+		
+		void release(std::size_t count = 1);
+		
+		/// The number of units which can be acquired without waiting.
+		std::size_t available() const noexcept
+		{
+			std::lock_guard<Spinlock> lock(_lock);
+			
+			return _available;
+		}
+		
+		/// The number of fibers waiting to acquire a unit.
+		std::size_t count() const noexcept
+		{
+			std::lock_guard<Spinlock> lock(_lock);
+			
+			return _waiters.count();
+		}
+		
+	private:
+		mutable Spinlock _lock;
+		
+		// Units are only available when no fibers are waiting:
+		std::size_t _available;
+		
+		Waiters _waiters;
+	};
+}
@@ -0,0 +1,142 @@
+//
+//  SharedMutex.cpp
+//  File file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "SharedMutex.hpp"
+
+namespace Concurrent
+{
+	void SharedMutex::lock()
+	{
+		_lock.lock();
+		
+		if (writable()) {
+			_writer = true;
+			_lock.unlock();
+			
+			return;
+		}
+		
+		_writers.wait(_lock, [this]{unlock();});
+	}
+	
+	bool SharedMutex::try_lock() noexcept
+	{
+		std::lock_guard<Spinlock> lock(_lock);
+		
+		if (!writable()) return false;
+		
+		_writer = true;
+		
+		return true;
+	}
+	
+	void SharedMutex::unlock()
+	{
+		_lock.lock();
+		
+		_writer = false;
+		
+		if (!_shared.empty()) {
+			_admitting = _shared.count();
+			_lock.unlock();
+			
+			admit();
+		} else {
+			handoff();
+		}
+	}
+	
+	void SharedMutex::lock_shared()
+	{
+		_lock.lock();
+		
+		if (readable()) {
+			_readers += 1;
+			_lock.unlock();
+			
+			return;
+		}
+		
+		_shared.wait(_lock, [this]{unlock_shared();});
+	}
+	
+	bool SharedMutex::try_lock_shared() noexcept
+	{
+		std::lock_guard<Spinlock> lock(_lock);
+		
+		if (!readable()) return false;
+		
+		_readers += 1;
+		
+		return true;
+	}
+	
+	void SharedMutex::unlock_shared()
+	{
+		_lock.lock();
+		
+		_readers -= 1;
+		
+		if (writable()) {
+			handoff();
+		} else {
+			_lock.unlock();
+		}
+	}
+	
+	void SharedMutex::admit()
+	{
+		while (true) {
+			_lock.lock();
+			
+			Waiters::Waiter * waiter = nullptr;
+			
+			if (_admitting) {
+				waiter = _shared.pop();
+				
+				// Fewer readers may be waiting than expected, if some were stopped:
+				if (waiter) {
+					_admitting -= 1;
+					_readers += 1;
+				} else {
+					_admitting = 0;
+				}
+			}
+			
+			if (!waiter) break;
+			
+			_lock.unlock();
+			
+			waiter->schedule();
+		}
+		
+		// The admitted readers may have already unlocked:
+		if (writable()) {
+			handoff();
+		} else {
+			_lock.unlock();
+		}
+	}
+	
+	void SharedMutex::handoff()
+	{
+		if (auto waiter = _writers.pop()) {
+			_writer = true;
+			_lock.unlock();
+			
+			waiter->schedule();
+		} else if (!_shared.empty()) {
+			_admitting = _shared.count();
+			_lock.unlock();
+			
+			admit();
+		} else {
+			_lock.unlock();
+		}
+	}
+}
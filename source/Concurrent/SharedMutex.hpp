@@ -0,0 +1,55 @@
+//
+//  SharedMutex.hpp
+//  File file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Waiters.hpp"
+
+namespace Concurrent
+{
+	// A reader-writer lock which suspends the current fiber rather than blocking the thread. It is compatible with std::unique_lock and std::shared_lock.
+	// Readers queue behind waiting writers, and a writer unlocking admits all waiting readers before the next writer, so neither can be starved. Ownership is handed directly to the fibers which are woken.
+	class SharedMutex
+	{
+	public:
+		SharedMutex() noexcept {}
+		
+		SharedMutex(const SharedMutex & other) = delete;
+		SharedMutex & operator=(const SharedMutex & other) = delete;
+		
+		void lock();
+		bool try_lock() noexcept;
+		void unlock();
+		
+		void lock_shared();
+		bool try_lock_shared() noexcept;
+		void unlock_shared();
+		
+	private:
+		// With the lock held:
+		bool writable() const noexcept {return !_writer && _readers == 0 && _admitting == 0;}
+		bool readable() const noexcept {return !_writer && _writers.empty();}
+		
+		// Wake the readers which were waiting when the writer unlocked.
+		void admit();
+		
+		// Once the mutex is writable, hand it to the next writer, or otherwise admit any waiting readers. The lock must be held, and is released.
+		void handoff();
+		
+		mutable Spinlock _lock;
+		
+		bool _writer = false;
+		std::size_t _readers = 0;
+		
+		// The number of waiting readers which are still to be admitted:
+		std::size_t _admitting = 0;
+		
+		Waiters _writers;
+		Waiters _shared;
+	};
+}
@@ -0,0 +1,107 @@
+//
+//  Sizing.cpp
+//  File file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Sizing.hpp"
+
+#include <unistd.h>
+
+#include <iostream>
+#include <sstream>
+#include <algorithm>
+
+namespace Concurrent
+{
+	constexpr std::size_t Sizing::DEFAULT_MINIMUM_STACK_SIZE;
+	
+	Sizing::Sizing(std::size_t minimum, std::size_t maximum, double margin) : _minimum(minimum), _maximum(maximum), _margin(margin)
+	{
+	}
+	
+	void Sizing::record(const Fiber & fiber)
+	{
+		record(fiber.annotation(), fiber.stack().used());
+	}
+	
+	void Sizing::record(const std::string & annotation, std::size_t used)
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		
+		auto & usage = _usage[annotation];
+		
+		usage.samples += 1;
+		usage.peak = std::max(usage.peak, used);
+	}
+	
+	Sizing::Usage Sizing::usage(const char * annotation) const
+	{
+		if (annotation == nullptr) annotation = "";
+		
+		std::lock_guard<std::mutex> lock(_mutex);
+		
+		auto iterator = _usage.find(annotation);
+		
+		if (iterator == _usage.end()) return Usage();
+		
+		return iterator->second;
+	}
+	
+	std::size_t Sizing::stack_size(const char * annotation) const
+	{
+		static const std::size_t PAGE_SIZE = sysconf(_SC_PAGESIZE);
+		
+		auto usage = this->usage(annotation);
+		
+		if (usage.samples == 0) return _maximum;
+		
+		auto size = static_cast<std::size_t>(usage.peak * _margin);
+		size = (size + PAGE_SIZE - 1) / PAGE_SIZE * PAGE_SIZE;
+		
+		return std::min(std::max(size, _minimum), _maximum);
+	}
+	
+	void Sizing::report(std::ostream & output) const
+	{
+		std::map<std::string, Usage, std::less<>> usage;
+		
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			usage = _usage;
+		}
+		
+		output << "# annotation\tsamples\tpeak\tstack_size" << std::endl;
+		
+		for (auto & entry : usage) {
+			output << entry.first << '\t' << entry.second.samples << '\t' << entry.second.peak << '\t' << stack_size(entry.first.c_str()) << std::endl;
+		}
+	}
+	
+	void Sizing::load(std::istream & input)
+	{
+		std::string line;
+		
+		while (std::getline(input, line)) {
+			if (line.empty() || line[0] == '#') continue;
+			
+			// Annotations may contain spaces, so only tabs separate the fields:
+			auto tab = line.find('\t');
+			if (tab == std::string::npos) continue;
+			
+			std::istringstream fields(line.substr(tab + 1));
+			Usage loaded;
+			
+			if (!(fields >> loaded.samples >> loaded.peak)) continue;
+			
+			std::lock_guard<std::mutex> lock(_mutex);
+			
+			auto & usage = _usage[line.substr(0, tab)];
+			
+			usage.samples += loaded.samples;
+			usage.peak = std::max(usage.peak, loaded.peak);
+		}
+	}
+}
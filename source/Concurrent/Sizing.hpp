@@ -0,0 +1,62 @@
+//
+//  Sizing.hpp
+//  File file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Fiber.hpp"
+
+#include <map>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <iosfwd>
+
+namespace Concurrent
+{
+	// Records the peak stack usage of fibers by annotation, and chooses stack sizes for new fibers with the same annotation. A report of the observations can be saved, and loaded again later, so that sizes measured in a profiling run can be used without measuring again.
+	class Sizing
+	{
+	public:
+		static constexpr std::size_t DEFAULT_MINIMUM_STACK_SIZE = 1024*16;
+		
+		/// @param margin the multiple of the peak usage to allocate, to allow for paths which were not observed.
+		Sizing(std::size_t minimum = DEFAULT_MINIMUM_STACK_SIZE, std::size_t maximum = Fiber::DEFAULT_STACK_SIZE, double margin = 2.0);
+		
+		Sizing(const Sizing & other) = delete;
+		Sizing & operator=(const Sizing & other) = delete;
+		
+		struct Usage
+		{
+			std::size_t samples = 0;
+			std::size_t peak = 0;
+		};
+		
+		/// Record the stack usage of a fiber, which should have finished, since usage is measured up to now.
+		void record(const Fiber & fiber);
+		void record(const std::string & annotation, std::size_t used);
+		
+		Usage usage(const char * annotation) const;
+		
+		/// The stack size for a new fiber with the given annotation: the peak usage times the margin, rounded up to whole pages, between the minimum and maximum. Fibers which have not been observed get the maximum.
+		std::size_t stack_size(const char * annotation) const;
+		
+		/// Write one line per annotation with the number of samples, the peak usage and the chosen stack size, separated by tabs.
+		void report(std::ostream & output) const;
+		
+		/// Merge the observations from a report.
+		void load(std::istream & input);
+		
+	private:
+		std::size_t _minimum, _maximum;
+		double _margin;
+		
+		mutable std::mutex _mutex;
+		// Ordered for the report, and looked up without constructing a string:
+		std::map<std::string, Usage, std::less<>> _usage;
+	};
+}
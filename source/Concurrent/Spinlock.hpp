@@ -0,0 +1,56 @@
+//
+//  Spinlock.hpp
+//  File file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include <atomic>
+
+namespace Concurrent
+{
+	// A lock for very short critical sections, which are shared between fibers running on different threads. It is compatible with std::lock_guard.
+	class Spinlock
+	{
+	public:
+		Spinlock() noexcept {}
+		
+		Spinlock(const Spinlock & other) = delete;
+		Spinlock & operator=(const Spinlock & other) = delete;
+		
+		void lock() noexcept
+		{
+			while (_locked.exchange(true, std::memory_order_acquire)) {
+				// Wait until the lock appears to be free, without invalidating the cache line:
+				while (_locked.load(std::memory_order_relaxed)) {
+					relax();
+				}
+			}
+		}
+		
+		bool try_lock() noexcept
+		{
+			return !_locked.load(std::memory_order_relaxed) && !_locked.exchange(true, std::memory_order_acquire);
+		}
+		
+		void unlock() noexcept
+		{
+			_locked.store(false, std::memory_order_release);
+		}
+		
+		static void relax() noexcept
+		{
+#if defined(__x86_64__) || defined(__i386__)
+			__builtin_ia32_pause();
+#elif defined(__aarch64__)
+			asm volatile("yield");
+#endif
+		}
+		
+	private:
+		std::atomic<bool> _locked{false};
+	};
+}
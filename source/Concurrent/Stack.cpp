@@ -12,14 +12,70 @@
 #include <stddef.h>
 
 #include <sys/mman.h>
+#include <sys/syscall.h>
+
+#if defined(__linux__)
+#include <linux/mempolicy.h>
+#endif
 
 #include <system_error>
+#include <iostream>
+#include <cstdlib>
+#include <cassert>
+
+#if defined(CONCURRENT_SANITIZE_ADDRESS)
+#include <sanitizer/asan_interface.h>
+#endif
 
 namespace Concurrent
 {
 	const std::size_t Stack::ALIGNMENT = 16;
 	
-	Stack::Stack(std::size_t size)
+	constexpr int Stack::Options::ANY_NODE;
+	constexpr int Stack::Options::LOCAL_NODE;
+	
+	// Apply the placement options to a new mapping, before any of it has been touched.
+	static void place(void * address, std::size_t size, const Stack::Options & options)
+	{
+		int node = options.node;
+		
+#if defined(SYS_getcpu)
+		if (node == Stack::Options::LOCAL_NODE) {
+			unsigned cpu = 0, local = 0;
+			
+			if (::syscall(SYS_getcpu, &cpu, &local, nullptr) == 0) {
+				node = local;
+			}
+		}
+#endif
+		
+		// MPOL_PREFERRED is an enumerator rather than a macro, so it can't be tested for:
+#if defined(__linux__) && defined(SYS_mbind)
+		if (node >= 0) {
+			const std::size_t BITS = sizeof(unsigned long) * 8;
+			std::vector<unsigned long> mask(node / BITS + 1);
+			mask[node / BITS] |= 1ul << (node % BITS);
+			
+			// The kernel ignores the last bit of the mask, hence the extra bit:
+			if (::syscall(SYS_mbind, address, size, MPOL_PREFERRED, mask.data(), mask.size() * BITS + 1, 0) == -1 && errno != ENOSYS) {
+				throw std::system_error(errno, std::generic_category(), "mbind(...)");
+			}
+		}
+#endif
+		
+#if defined(MADV_HUGEPAGE)
+		// This fails if the kernel was built without transparent huge pages, in which case the advice is ignored:
+		if (options.huge_pages && ::madvise(address, size, MADV_HUGEPAGE) == -1 && errno != EINVAL) {
+			throw std::system_error(errno, std::generic_category(), "madvise(...)");
+		}
+#endif
+	}
+	
+	Stack::Stack(std::size_t size) : Stack(size, Options())
+	{
+	}
+	
+	Stack::Stack(std::size_t size, const Options & options)
 	{
 		const std::size_t GUARD_PAGES = 1;
 		static const std::size_t PAGE_SIZE = sysconf(_SC_PAGESIZE);
@@ -36,14 +92,30 @@ namespace Concurrent
 			throw std::system_error(errno, std::generic_category(), "mmap(...)");
 		}
 		
+		try {
+			place(_base, stack_size, options);
+		} catch (...) {
+			::munmap(_base, stack_size);
+			_base = nullptr;
+			
+			throw;
+		}
+		
 		// The top of the stack:
 		_top = (Byte*)_base + stack_size;
 		
 		// The current top of the stack, taking into account any emplacements:
 		_current = _top;
 		
-		// Protect the bottom of the stack so we don't have silent stack overflow:
-		::mprotect(_base, GUARD_PAGES*PAGE_SIZE, PROT_NONE);
+		// Protect the bottom of the stack so we don't have silent stack overflow. This fails if the process has run out of memory mappings, and without the guard page the stack would be merged with its neighbours:
+		if (::mprotect(_base, GUARD_PAGES*PAGE_SIZE, PROT_NONE) == -1) {
+			auto error = errno;
+			
+			::munmap(_base, stack_size);
+			_base = nullptr;
+			
+			throw std::system_error(error, std::generic_category(), "mprotect(...)");
+		}
 		_bottom = (Byte*)_base + GUARD_PAGES*PAGE_SIZE;
 	}
 	
@@ -53,44 +125,250 @@ namespace Concurrent
 	
 	Stack::~Stack() noexcept(false)
 	{
-		if (_base) {
-			auto result = ::munmap(_base, (Byte*)_top - (Byte*)_base);
-			
-			if (result == -1) {
-				throw std::system_error(errno, std::generic_category(), "munmap(...)");
+		deallocate();
+	}
+	
+	void Stack::deallocate()
+	{
+		if (_base == nullptr) return;
+		
+#if defined(CONCURRENT_SANITIZE_ADDRESS)
+		// Frames which were unwound by switching fibers may still be poisoned, and the shadow memory would otherwise outlive the mapping:
+		__asan_unpoison_memory_region(_base, (Byte*)_top - (Byte*)_base);
+#endif
+		
+		if (_arena) {
+			_arena->deallocate(*this);
+		} else if (::munmap(_base, (Byte*)_top - (Byte*)_base) == -1) {
+			throw std::system_error(errno, std::generic_category(), "munmap(...)");
+		}
+		
+		_base = _bottom = _current = _top = nullptr;
+		_arena = nullptr;
+	}
+	
+	void Stack::reset() noexcept
+	{
+		_current = _top;
+		
+#if defined(CONCURRENT_SANITIZE_ADDRESS)
+		__asan_unpoison_memory_region(_bottom, (Byte*)_top - (Byte*)_bottom);
+#endif
+	}
+	
+	void Stack::release()
+	{
+		if (_bottom == nullptr) return;
+		
+		auto size = (Byte*)_top - (Byte*)_bottom;
+		
+#if defined(MADV_FREE)
+		// Older kernels don't support MADV_FREE, in which case we fall back to MADV_DONTNEED below:
+		if (::madvise(_bottom, size, MADV_FREE) == 0) return;
+#endif
+		
+		if (::madvise(_bottom, size, MADV_DONTNEED) == -1) {
+			throw std::system_error(errno, std::generic_category(), "madvise(...)");
+		}
+	}
+	
+	void Stack::discard()
+	{
+		if (_bottom == nullptr) return;
+		
+		if (::madvise(_bottom, (Byte*)_top - (Byte*)_bottom, MADV_DONTNEED) == -1) {
+			throw std::system_error(errno, std::generic_category(), "madvise(...)");
+		}
+	}
+	
+	std::size_t Stack::trim(const void * stack_pointer)
+	{
+		// The System V ABI lets leaf functions use this much space below the stack pointer without adjusting it:
+		const std::size_t RED_ZONE = 128;
+		static const std::size_t PAGE_SIZE = sysconf(_SC_PAGESIZE);
+		
+		assert(stack_pointer > _bottom && stack_pointer <= _current);
+		
+		// Keep the page which contains the red zone:
+		auto end = reinterpret_cast<std::uintptr_t>(stack_pointer) - RED_ZONE;
+		end -= end % PAGE_SIZE;
+		
+		auto bottom = reinterpret_cast<std::uintptr_t>(_bottom);
+		if (end <= bottom) return 0;
+		
+		if (::madvise(_bottom, end - bottom, MADV_DONTNEED) == -1) {
+			throw std::system_error(errno, std::generic_category(), "madvise(...)");
+		}
+		
+		return end - bottom;
+	}
+	
+	std::size_t Stack::used() const
+	{
+		if (_bottom == nullptr) return 0;
+		
+		static const std::size_t PAGE_SIZE = sysconf(_SC_PAGESIZE);
+		
+		auto size = (Byte*)_top - (Byte*)_bottom;
+		
+		// The residency of each page is reported as unsigned char on Linux, but char on BSD and macOS:
+#if defined(__linux__)
+		std::vector<unsigned char> pages((size + PAGE_SIZE - 1) / PAGE_SIZE);
+#else
+		std::vector<char> pages((size + PAGE_SIZE - 1) / PAGE_SIZE);
+#endif
+		
+		if (::mincore(_bottom, size, pages.data()) == -1) {
+			throw std::system_error(errno, std::generic_category(), "mincore(...)");
+		}
+		
+		// The stack grows down, so the first resident page is the deepest one which has been touched:
+		for (std::size_t index = 0; index < pages.size(); index += 1) {
+			if (pages[index] & 1) {
+				return (Byte*)_top - ((Byte*)_bottom + index * PAGE_SIZE);
 			}
 		}
+		
+		return 0;
 	}
 	
-	Stack::Stack(Stack && other)
+	Stack::Stack(Stack && other) noexcept
 	{
 		_base = other._base;
 		_bottom = other._bottom;
 		_current = other._current;
 		_top = other._top;
+		_arena = other._arena;
 		
 		other._base = nullptr;
 		other._bottom = nullptr;
 		other._current = nullptr;
 		other._top = nullptr;
+		other._arena = nullptr;
 	}
 	
-	Stack & Stack::operator=(Stack && other)
+	Stack & Stack::operator=(Stack && other) noexcept
 	{
 		if (_base) {
-			::munmap(_base, (Byte*)_top - (Byte*)_base);
+			if (_arena) {
+				_arena->deallocate(*this);
+			} else {
+				::munmap(_base, (Byte*)_top - (Byte*)_base);
+			}
 		}
 		
 		_base = other._base;
 		_bottom = other._bottom;
 		_current = other._current;
 		_top = other._top;
+		_arena = other._arena;
 		
 		other._base = nullptr;
 		other._bottom = nullptr;
 		other._current = nullptr;
 		other._top = nullptr;
+		other._arena = nullptr;
 		
 		return *this;
 	}
+	
+	constexpr std::size_t Stack::Arena::DEFAULT_GUARD_INTERVAL;
+	
+	Stack::Arena::Arena(std::size_t stack_size, std::size_t capacity, std::size_t guard_interval, const Options & options) : _capacity(capacity), _guard_interval(guard_interval)
+	{
+		static const std::size_t PAGE_SIZE = sysconf(_SC_PAGESIZE);
+		
+		// Every slot has room for a guard page, even if it isn't protected, so that the slots are all the same size:
+		auto page_count = (stack_size + ALIGNMENT + PAGE_SIZE - 1) / PAGE_SIZE;
+		_slot_size = (1 + page_count) * PAGE_SIZE;
+		_stack_size = page_count * PAGE_SIZE - ALIGNMENT;
+		
+		int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+		
+#if defined(MAP_NORESERVE)
+		flags |= MAP_NORESERVE;
+#endif
+		
+		_base = ::mmap(0, _slot_size * _capacity, PROT_READ | PROT_WRITE, flags, -1, 0);
+		
+		if (_base == MAP_FAILED) {
+			_base = nullptr;
+			
+			throw std::system_error(errno, std::generic_category(), "mmap(...)");
+		}
+		
+		try {
+			place(_base, _slot_size * _capacity, options);
+		} catch (...) {
+			::munmap(_base, _slot_size * _capacity);
+			
+			throw;
+		}
+		
+		_free.reserve(_capacity);
+	}
+	
+	Stack::Arena::~Arena()
+	{
+		assert(_count == 0);
+		
+		if (_base) {
+			::munmap(_base, _slot_size * _capacity);
+		}
+	}
+	
+	std::uintptr_t Stack::Arena::expected_canary(std::size_t index) const noexcept
+	{
+		return 0x5374616b43616e79ull ^ reinterpret_cast<std::uintptr_t>(canary(index));
+	}
+	
+	Stack Stack::Arena::allocate()
+	{
+		std::size_t index;
+		
+		{
+			std::lock_guard<Spinlock> lock(_lock);
+			
+			if (!_free.empty()) {
+				index = _free.back();
+				_free.pop_back();
+			} else if (_next < _capacity) {
+				index = _next;
+				
+				// Guard pages are protected the first time their slot is used, so that unused slots don't cost any mappings:
+				if (guarded(index) && ::mprotect(slot(index), _slot_size - _stack_size - ALIGNMENT, PROT_NONE) == -1) {
+					throw std::system_error(errno, std::generic_category(), "mprotect(...)");
+				}
+				
+				_next += 1;
+			} else {
+				throw std::system_error(ENOMEM, std::generic_category(), "Stack::Arena::allocate");
+			}
+			
+			_count += 1;
+		}
+		
+		*canary(index) = expected_canary(index);
+		
+		auto base = slot(index);
+		auto top = slot(index + 1) - ALIGNMENT;
+		
+		return Stack(this, base, top - _stack_size, top);
+	}
+	
+	void Stack::Arena::deallocate(Stack & stack) noexcept
+	{
+		auto index = ((Byte*)stack._base - (Byte*)_base) / _slot_size;
+		
+		// The slot above this one has overflowed into it, and this stack may have been corrupted:
+		if (*canary(index) != expected_canary(index)) {
+			std::cerr << "Stack::Arena: stack overflow detected in slot " << index + 1 << " of arena " << this << "!" << std::endl;
+			std::abort();
+		}
+		
+		std::lock_guard<Spinlock> lock(_lock);
+		
+		_free.push_back(index);
+		_count -= 1;
+	}
 }
@@ -10,6 +10,19 @@
 
 #include <memory>
 #include <algorithm>
+#include <vector>
+#include <mutex>
+#include <cstdint>
+
+#include "Spinlock.hpp"
+
+#if defined(__SANITIZE_ADDRESS__)
+	#define CONCURRENT_SANITIZE_ADDRESS
+#elif defined(__has_feature)
+	#if __has_feature(address_sanitizer)
+		#define CONCURRENT_SANITIZE_ADDRESS
+	#endif
+#endif
 
 namespace Concurrent
 {
@@ -18,14 +31,33 @@ namespace Concurrent
 		typedef unsigned char Byte;
 		
 	public:
+		class Arena;
+		
+		// Where the memory for a stack is placed. Placement is advisory, and kernels which don't support it ignore it.
+		struct Options
+		{
+			// Don't prefer any NUMA node:
+			static constexpr int ANY_NODE = -1;
+			
+			// Prefer the NUMA node of the CPU which allocates the stack, e.g. the worker which spawns a fiber:
+			static constexpr int LOCAL_NODE = -2;
+			
+			// Pages are allocated from this node when it has free memory, using mbind with MPOL_PREFERRED:
+			int node = ANY_NODE;
+			
+			// Back the stack with transparent huge pages, which reduces TLB misses when switching between many stacks, but commits memory in much larger units. This is best suited to arenas of stacks which will mostly be touched.
+			bool huge_pages = false;
+		};
+		
 		Stack(std::size_t size);
+		Stack(std::size_t size, const Options & options);
 		Stack();
 		
 		Stack(const Stack & other) = delete;
 		Stack & operator=(const Stack & other) = delete;
 		
-		Stack(Stack && other);
-		Stack & operator=(Stack && other);
+		Stack(Stack && other) noexcept;
+		Stack & operator=(Stack && other) noexcept;
 		
 		~Stack() noexcept(false);
 		
@@ -61,6 +93,25 @@ namespace Concurrent
 			return new(_current) Type(std::move(value));
 		};
 		
+		// Discard all emplacements, so that the stack can be reused by a new fiber.
+		void reset() noexcept;
+		
+		// Advise the kernel that the contents of the stack are no longer required. The pages remain mapped, but may be reclaimed lazily under memory pressure.
+		void release();
+		
+		// Drop the contents of the stack immediately, so that its pages are no longer resident, and are zero-filled when next touched.
+		void discard();
+		
+		// Drop the pages below the given stack pointer, which must belong to a suspended fiber, since frames below it are no longer in use. The pages stay mapped, and are zero-filled if the fiber needs them again.
+		// @returns the number of bytes which were trimmed.
+		std::size_t trim(const void * stack_pointer);
+		
+		// The distance from the top of the stack to the lowest resident page, as reported by mincore. Pages stay resident once touched, so this is the high-water mark of the stack since it was mapped or discarded, rounded up to whole pages. Pages which were swapped out are not counted.
+		std::size_t used() const;
+		
+		// The arena which the stack was allocated from, if any.
+		Arena * arena() const noexcept {return _arena;}
+		
 		// A pointer to the stack memory allocation.
 		void * base() {return _base;}
 		void * bottom() {return _bottom;}
@@ -72,6 +123,73 @@ namespace Concurrent
 		std::size_t allocated_size() {return (Byte*)top() - (Byte*)base();}
 		
 	private:
+		Stack(Arena * arena, void * base, void * bottom, void * top) noexcept : _base(base), _bottom(bottom), _current(top), _top(top), _arena(arena) {}
+		
+		// Unmap the stack, or return it to the arena it was allocated from.
+		void deallocate();
+		
 		void * _base, * _bottom, * _current, * _top;
+		Arena * _arena = nullptr;
+	};
+	
+	// Reserves a single mapping which is divided into slots for stacks of the same size, so allocating a stack doesn't create a new memory mapping. The mapping is not reserved against the commit limit, and only pages which are touched consume memory.
+	// A guard page below a slot splits the mapping, costing two more mappings, so only every Nth slot has one. Instead, every slot has a canary at its top, where an overflow from the slot above it lands first. Canaries are checked when stacks are freed, and a corrupted canary aborts the process.
+	class Stack::Arena
+	{
+	public:
+		static constexpr std::size_t DEFAULT_GUARD_INTERVAL = 64;
+		
+		/// @param capacity the maximum number of stacks which can be allocated at once.
+		/// @param guard_interval every Nth slot has a guard page, or none if zero. An interval of one guards every slot, like individually mapped stacks.
+		/// @param options the placement of the whole mapping. A local node is the node of the CPU which constructs the arena.
+		Arena(std::size_t stack_size, std::size_t capacity, std::size_t guard_interval = DEFAULT_GUARD_INTERVAL, const Options & options = Options());
+		
+		// All stacks allocated from the arena must have been freed.
+		~Arena();
+		
+		Arena(const Arena & other) = delete;
+		Arena & operator=(const Arena & other) = delete;
+		
+		/// Allocate a stack in constant time. The stack returns to the arena when it goes out of scope.
+		/// @throws std::system_error with ENOMEM if all slots are in use.
+		Stack allocate();
+		
+		std::size_t capacity() const noexcept {return _capacity;}
+		
+		/// The number of stacks which are currently allocated.
+		std::size_t count() const noexcept
+		{
+			std::lock_guard<Spinlock> lock(_lock);
+			
+			return _count;
+		}
+		
+		/// The usable size of each stack.
+		std::size_t stack_size() const noexcept {return _stack_size;}
+		
+	private:
+		friend class Stack;
+		
+		void deallocate(Stack & stack) noexcept;
+		
+		Byte * slot(std::size_t index) const noexcept {return (Byte*)_base + index * _slot_size;}
+		bool guarded(std::size_t index) const noexcept {return _guard_interval && (index % _guard_interval) == 0;}
+		
+		// The canary is stored at the top of each slot, and depends on its address:
+		std::uintptr_t * canary(std::size_t index) const noexcept {return (std::uintptr_t*)(slot(index + 1) - ALIGNMENT);}
+		std::uintptr_t expected_canary(std::size_t index) const noexcept;
+		
+		std::size_t _stack_size, _slot_size, _capacity, _guard_interval;
+		void * _base = nullptr;
+		
+		mutable Spinlock _lock;
+		
+		// Slots which have been freed, most recently freed last, since they are the most likely to still be resident:
+		std::vector<std::uint32_t> _free;
+		
+		// Slots at or above this index have never been used:
+		std::size_t _next = 0;
+		
+		std::size_t _count = 0;
 	};
 }
@@ -0,0 +1,115 @@
+//
+//  TaskGroup.cpp
+//  File file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "TaskGroup.hpp"
+
+#include <system_error>
+#include <cerrno>
+
+namespace Concurrent
+{
+	void TaskState::wait()
+	{
+		while (!finished) {
+			// The waiting fiber was asked to stop before the task finished:
+			if (!group->_completion.wait()) throw Stop();
+		}
+		
+		if (exception) std::rethrow_exception(exception);
+		
+		if (!returned) throw std::system_error(ECANCELED, std::generic_category(), "Task::get");
+	}
+	
+	TaskGroup::TaskGroup(std::size_t stack_size, const Stack::Options & options) : _stack_size(stack_size), _options(options)
+	{
+	}
+	
+	TaskGroup::TaskGroup(Stack::Arena & arena) : _stack_size(arena.stack_size()), _arena(&arena)
+	{
+	}
+	
+	TaskGroup::~TaskGroup()
+	{
+		cancel();
+		
+		// Destroying a task which is still suspended stops it:
+		while (!_tasks.empty()) {
+			auto state = static_cast<TaskState *>(_tasks.next);
+			state->unlink();
+			
+			Stack stack = Fiber::destroy(state->fiber);
+			
+			// The state is above the fiber on the same stack, so it must be destroyed before the stack is released:
+			state->~TaskState();
+		}
+	}
+	
+	Stack TaskGroup::acquire()
+	{
+		if (_arena) return _arena->allocate();
+		
+		return Stack(_stack_size, _options);
+	}
+	
+	void TaskGroup::join()
+	{
+		while (_running > 0) {
+			if (!_completion.wait()) {
+				cancel();
+				
+				// Tasks which aren't waiting on a condition may not have finished yet, but the joining fiber can't wait for them any longer:
+				if (_running > 0) throw Stop();
+			}
+		}
+		
+		if (_exception) std::rethrow_exception(_exception);
+	}
+	
+	void TaskGroup::cancel()
+	{
+		_cancelled = true;
+		
+		for (auto link = _tasks.next; link != &_tasks; ) {
+			auto state = static_cast<TaskState *>(link);
+			
+			// Asking a task to stop may run it to completion, and it may spawn more tasks, which are appended to the list:
+			link = link->next;
+			
+			if (!state->finished) state->fiber->request_stop();
+		}
+	}
+	
+	void TaskGroup::failed(TaskState & state, std::exception_ptr exception)
+	{
+		state.exception = exception;
+		
+		if (!_exception) {
+			_exception = exception;
+			
+			cancel();
+		}
+	}
+	
+	void TaskGroup::finished(TaskState & state)
+	{
+		// Waking other fibers here would run them on the task's stack, which they could release by destroying the group before the task has returned:
+		state.invoke = exited;
+		state.fiber->_handoff = &state;
+	}
+	
+	void TaskGroup::exited(Fiber::Handoff & handoff, Fiber &)
+	{
+		auto & state = static_cast<TaskState &>(handoff);
+		auto & group = *state.group;
+		
+		state.finished = true;
+		group._running -= 1;
+		
+		group._completion.resume();
+	}
+}
@@ -0,0 +1,229 @@
+//
+//  TaskGroup.hpp
+//  File file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Fiber.hpp"
+#include "Condition.hpp"
+#include "Link.hpp"
+
+#include <exception>
+#include <type_traits>
+#include <utility>
+
+namespace Concurrent
+{
+	class TaskGroup;
+	
+	// The state of a task, which is emplaced on the task's stack above its fiber, so that spawning a task doesn't allocate. It lives until the group is destroyed, and is also the handoff which marks the task finished once its fiber has exited.
+	class TaskState : public Link, public Fiber::Handoff
+	{
+	public:
+		virtual ~TaskState() {}
+		
+		TaskGroup * group = nullptr;
+		Fiber * fiber = nullptr;
+		
+		// Set once the task has returned, failed or been cancelled, and its fiber has exited:
+		bool finished = false;
+		
+		// The exception which the task failed with, if any:
+		std::exception_ptr exception;
+		
+		// Whether the task returned a value, rather than failing or being cancelled:
+		bool returned = false;
+		
+		/// Wait for the task to finish, and raise the exception it failed with, or ECANCELED if it was cancelled.
+		void wait();
+	};
+	
+	// A handle to a task spawned by a TaskGroup, which can be used to wait for its result. It is only valid while the group exists.
+	template <typename Type>
+	class Task
+	{
+		struct State : public TaskState
+		{
+			typename std::aligned_storage<sizeof(Type), alignof(Type)>::type storage;
+			
+			template <typename FunctionT>
+			void invoke(FunctionT & function)
+			{
+				new(&storage) Type(function());
+				returned = true;
+			}
+			
+			Type & value() noexcept {return *reinterpret_cast<Type *>(&storage);}
+			
+			~State()
+			{
+				if (returned) value().~Type();
+			}
+		};
+		
+	public:
+		Task(State * state) noexcept : _state(state) {}
+		
+		/// Whether the task has returned, failed or been cancelled.
+		bool finished() const noexcept {return _state->finished;}
+		
+		/// Wait for the task to finish and return its result, which is stored inline on the task's stack. If the task failed, the exception it failed with is raised, and if it was cancelled, std::system_error with ECANCELED is raised.
+		Type & get()
+		{
+			_state->wait();
+			
+			return _state->value();
+		}
+		
+		Fiber & fiber() noexcept {return *_state->fiber;}
+		
+	private:
+		State * _state;
+		
+		friend class TaskGroup;
+	};
+	
+	template <>
+	class Task<void>
+	{
+		struct State : public TaskState
+		{
+			template <typename FunctionT>
+			void invoke(FunctionT & function)
+			{
+				function();
+				returned = true;
+			}
+		};
+		
+	public:
+		Task(State * state) noexcept : _state(state) {}
+		
+		bool finished() const noexcept {return _state->finished;}
+		
+		void get()
+		{
+			_state->wait();
+		}
+		
+		Fiber & fiber() noexcept {return *_state->fiber;}
+		
+	private:
+		State * _state;
+		
+		friend class TaskGroup;
+	};
+	
+	// Runs a group of tasks on fibers of the current thread, and waits for all of them to finish. If any task fails, the rest are asked to stop, and join raises the first failure. Tasks are asked to stop using Fiber::request_stop, so a task which is waiting on a Condition sees its wait return false, while one waiting on e.g. a Mutex is unwound by Stop.
+	// A task is only finished once its fiber has exited, and fibers waiting for it are then woken by whichever fiber resumed it, rather than on its stack, so the group can be destroyed as soon as join returns.
+	class TaskGroup
+	{
+		// The type returned by a task's function. std::result_of is not used as it was removed in C++20:
+		template <typename FunctionT>
+		using Result = decltype(std::declval<typename std::decay<FunctionT>::type &>()());
+		
+	public:
+		/// @param stack_size the size of the stack allocated for each task.
+		TaskGroup(std::size_t stack_size = Fiber::DEFAULT_STACK_SIZE, const Stack::Options & options = Stack::Options());
+		
+		/// Allocate the stacks of tasks from the given arena, which must outlive the group.
+		TaskGroup(Stack::Arena & arena);
+		
+		// Any tasks which are still running are asked to stop, and then stopped if they haven't returned. Their stacks, and the results they hold, are released.
+		~TaskGroup();
+		
+		TaskGroup(const TaskGroup & other) = delete;
+		TaskGroup & operator=(const TaskGroup & other) = delete;
+		
+		/// Start a task, which runs until it first suspends before this returns. Once the group has been cancelled, new tasks are asked to stop before they start.
+		/// @returns a handle to the task, which is valid until the group is destroyed.
+		template <typename FunctionT>
+		Task<Result<FunctionT>> spawn(FunctionT && function)
+		{
+			return spawn(nullptr, std::forward<FunctionT>(function));
+		}
+		
+		template <typename FunctionT>
+		Task<Result<FunctionT>> spawn(const char * annotation, FunctionT && function)
+		{
+			typedef Task<Result<FunctionT>> TaskT;
+			
+			auto stack = acquire();
+			auto state = stack.emplace<typename TaskT::State>();
+			
+			auto fiber = Fiber::emplace(annotation, std::move(stack), [this, state, function = std::forward<FunctionT>(function)]() mutable {
+				Finish finish(*this, *state);
+				
+				try {
+					state->invoke(function);
+				} catch (Stop) {
+					// The task was cancelled, which isn't a failure.
+				} catch (...) {
+					// Exceptions don't escape the fiber, where they would be raised in whichever fiber resumed it:
+					failed(*state, std::current_exception());
+				}
+			});
+			
+			state->group = this;
+			state->fiber = fiber;
+			_tasks.push_back(*state);
+			_running += 1;
+			
+			if (_cancelled) fiber->request_stop();
+			
+			fiber->resume();
+			
+			return TaskT(state);
+		}
+		
+		/// Suspend the current fiber until all tasks have finished, and then raise the exception which the first failed task failed with, if any. If the current fiber is asked to stop while joining, the tasks are asked to stop too, and Stop is raised if any of them are still running.
+		void join();
+		
+		/// Ask all tasks which are still running to stop.
+		void cancel();
+		
+		/// Whether the group has been cancelled, either explicitly or because a task failed.
+		bool cancelled() const noexcept {return _cancelled;}
+		
+		/// The number of tasks which have not yet finished.
+		std::size_t running() const noexcept {return _running;}
+		
+	private:
+		// Marks the task as finished once its fiber exits, after its function returns.
+		struct Finish
+		{
+			TaskGroup & group;
+			TaskState & state;
+			
+			Finish(TaskGroup & group_, TaskState & state_) : group(group_), state(state_) {}
+			~Finish() {group.finished(state);}
+		};
+		
+		Stack acquire();
+		
+		void failed(TaskState & state, std::exception_ptr exception);
+		void finished(TaskState & state);
+		
+		// Invoked by the fiber which resumed the task, once the task's fiber has exited, and wakes the fibers waiting for tasks to finish:
+		static void exited(Fiber::Handoff & handoff, Fiber & fiber);
+		
+		std::size_t _stack_size = 0;
+		Stack::Options _options;
+		Stack::Arena * _arena = nullptr;
+		
+		Link _tasks;
+		std::size_t _running = 0;
+		
+		bool _cancelled = false;
+		std::exception_ptr _exception;
+		
+		// Resumed whenever a task finishes, for join and Task::get:
+		Condition _completion;
+		
+		friend class TaskState;
+	};
+}
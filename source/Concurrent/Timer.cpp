@@ -0,0 +1,196 @@
+//
+//  Timer.cpp
+//  File file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Timer.hpp"
+
+namespace Concurrent
+{
+	constexpr std::size_t Timer::Wheel::LEVELS;
+	constexpr std::size_t Timer::Wheel::BITS;
+	constexpr std::size_t Timer::Wheel::SLOTS;
+	
+	Timer::~Timer()
+	{
+		cancel();
+	}
+	
+	void Timer::cancel() noexcept
+	{
+		if (_wheel) {
+			unlink();
+			
+			_wheel->_count -= 1;
+			_wheel = nullptr;
+		}
+	}
+	
+	Timer::Wheel::Wheel(Clock::duration resolution, Clock::time_point start) : _start(start), _resolution(resolution)
+	{
+	}
+	
+	Timer::Wheel::~Wheel()
+	{
+		for (auto & level : _slots) {
+			for (auto & slot : level) {
+				while (slot.linked()) {
+					static_cast<Timer *>(slot.next)->cancel();
+				}
+			}
+		}
+		
+		while (_expired.linked()) {
+			static_cast<Timer *>(_expired.next)->cancel();
+		}
+	}
+	
+	Timer::Wheel & Timer::Wheel::local()
+	{
+		thread_local Wheel wheel;
+		
+		return wheel;
+	}
+	
+	void Timer::Wheel::insert(Timer & timer, Clock::duration timeout, Clock::time_point now)
+	{
+		insert_at(timer, now + timeout);
+	}
+	
+	void Timer::Wheel::insert_at(Timer & timer, Clock::time_point deadline)
+	{
+		timer.cancel();
+		
+		// Round up, so that a timer never expires early:
+		auto offset = deadline - _start;
+		std::uint64_t tick = offset.count() <= 0 ? 0 : (offset + _resolution - Clock::duration(1)) / _resolution;
+		
+		timer._deadline = tick;
+		timer._wheel = this;
+		_count += 1;
+		
+		if (tick <= _current) {
+			_expired.push_back(timer);
+		} else {
+			place(timer);
+		}
+	}
+	
+	void Timer::Wheel::place(Timer & timer)
+	{
+		auto delta = timer._deadline - _current;
+		std::size_t level = 0;
+		
+		while (level < LEVELS - 1 && delta >= (std::uint64_t(1) << (BITS * (level + 1)))) {
+			level += 1;
+		}
+		
+		auto deadline = timer._deadline;
+		
+		// Timers beyond the range of the wheel are placed in the furthest slot, and placed again when that slot is reached:
+		if (delta >= (std::uint64_t(1) << (BITS * LEVELS))) {
+			deadline = _current + (std::uint64_t(SLOTS - 1) << (BITS * (LEVELS - 1)));
+		}
+		
+		auto index = (deadline >> (BITS * level)) & (SLOTS - 1);
+		
+		_slots[level][index].push_back(timer);
+	}
+	
+	std::size_t Timer::Wheel::expire(Link & list)
+	{
+		std::size_t count = 0;
+		
+		// Expiring a timer may insert or cancel other timers, including those in the same list, so each one is removed before it expires:
+		while (list.linked()) {
+			auto timer = static_cast<Timer *>(list.next);
+			
+			timer->cancel();
+			
+			try {
+				timer->expire();
+			} catch (...) {
+				// The list is usually on the stack, so the remaining timers are kept for the next update:
+				_expired.splice(list);
+				
+				throw;
+			}
+			
+			count += 1;
+		}
+		
+		return count;
+	}
+	
+	std::size_t Timer::Wheel::advance()
+	{
+		_current += 1;
+		
+		// When a level wraps around, the timers in the next slot of the level above are placed again, at lower levels:
+		for (std::size_t level = 1; level < LEVELS; level += 1) {
+			if ((_current & ((std::uint64_t(1) << (BITS * level)) - 1)) != 0) break;
+			
+			Link cascade;
+			cascade.splice(_slots[level][(_current >> (BITS * level)) & (SLOTS - 1)]);
+			
+			while (cascade.linked()) {
+				auto timer = static_cast<Timer *>(cascade.next);
+				
+				timer->unlink();
+				place(*timer);
+			}
+		}
+		
+		Link expired;
+		expired.splice(_slots[0][_current & (SLOTS - 1)]);
+		
+		return expire(expired);
+	}
+	
+	std::size_t Timer::Wheel::update(Clock::time_point now)
+	{
+		auto offset = now - _start;
+		std::uint64_t tick = offset.count() <= 0 ? 0 : offset / _resolution;
+		
+		Link expired;
+		expired.splice(_expired);
+		
+		auto count = expire(expired);
+		
+		while (_current < tick) {
+			if (_count == 0) {
+				_current = tick;
+				break;
+			}
+			
+			count += advance();
+		}
+		
+		return count;
+	}
+	
+	Timer::Clock::duration Timer::Wheel::timeout(Clock::time_point now) const
+	{
+		if (_count == 0) return Clock::duration::max();
+		if (_expired.linked()) return Clock::duration::zero();
+		
+		// The next tick at which something needs to happen, either a timer expiring or timers moving down a level:
+		auto tick = ((_current >> BITS) + 1) << BITS;
+		
+		for (std::uint64_t offset = 1; offset < SLOTS; offset += 1) {
+			if (_slots[0][(_current + offset) & (SLOTS - 1)].linked()) {
+				tick = _current + offset;
+				break;
+			}
+		}
+		
+		auto deadline = _start + _resolution * tick;
+		
+		if (deadline <= now) return Clock::duration::zero();
+		
+		return deadline - now;
+	}
+}
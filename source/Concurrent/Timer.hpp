@@ -0,0 +1,103 @@
+//
+//  Timer.hpp
+//  File file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Link.hpp"
+
+#include <chrono>
+#include <cstdint>
+
+namespace Concurrent
+{
+	// A timer which can be scheduled on a timer wheel, typically allocated on the stack of the fiber which is waiting for it. Scheduling and cancelling a timer doesn't allocate memory.
+	class Timer : private Link
+	{
+	public:
+		class Wheel;
+		
+		typedef std::chrono::steady_clock Clock;
+		
+		Timer() noexcept {}
+		
+		// A timer which goes out of scope is cancelled.
+		virtual ~Timer();
+		
+		Timer(const Timer & other) = delete;
+		Timer & operator=(const Timer & other) = delete;
+		
+		bool scheduled() const noexcept {return _wheel != nullptr;}
+		
+		void cancel() noexcept;
+		
+	protected:
+		// Invoked by the wheel when the deadline has passed. The timer is no longer scheduled, so it can be rescheduled.
+		virtual void expire() = 0;
+		
+	private:
+		Wheel * _wheel = nullptr;
+		std::uint64_t _deadline = 0;
+		
+		friend class Wheel;
+	};
+	
+	// A hierarchical timing wheel, with constant time insertion and cancellation. Timers are placed in one of 256 slots at one of four levels, depending on how far away their deadline is, and are moved to lower levels as time advances. A wheel belongs to a single thread.
+	class Timer::Wheel
+	{
+	public:
+		static constexpr std::size_t LEVELS = 4;
+		static constexpr std::size_t BITS = 8;
+		static constexpr std::size_t SLOTS = 1 << BITS;
+		
+		Wheel(Clock::duration resolution = std::chrono::milliseconds(1), Clock::time_point start = Clock::now());
+		
+		// Any timers still scheduled are cancelled without expiring.
+		~Wheel();
+		
+		Wheel(const Wheel & other) = delete;
+		Wheel & operator=(const Wheel & other) = delete;
+		
+		/// The wheel for the current thread, which is updated by the reactor and scheduler workers.
+		static Wheel & local();
+		
+		/// Schedule the timer to expire once the timeout has passed. If the timer was already scheduled, it is rescheduled.
+		void insert(Timer & timer, Clock::duration timeout, Clock::time_point now = Clock::now());
+		void insert_at(Timer & timer, Clock::time_point deadline);
+		
+		/// Expire all timers whose deadline has passed.
+		/// @returns the number of timers which expired.
+		std::size_t update(Clock::time_point now = Clock::now());
+		
+		/// The duration until update should next be called, which may be earlier than the next deadline if timers need to move between levels, or Clock::duration::max() if there are no timers.
+		Clock::duration timeout(Clock::time_point now = Clock::now()) const;
+		
+		/// The number of scheduled timers.
+		std::size_t count() const noexcept {return _count;}
+		
+		Clock::duration resolution() const noexcept {return _resolution;}
+		
+	private:
+		void place(Timer & timer);
+		std::size_t advance();
+		std::size_t expire(Link & list);
+		
+		Clock::time_point _start;
+		Clock::duration _resolution;
+		
+		// The last tick which has been processed:
+		std::uint64_t _current = 0;
+		std::size_t _count = 0;
+		
+		Link _slots[LEVELS][SLOTS];
+		
+		// Timers whose deadline had already passed when they were inserted:
+		Link _expired;
+		
+		friend class Timer;
+	};
+}
@@ -0,0 +1,261 @@
+//
+//  Trace.cpp
+//  File file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Trace.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <mutex>
+
+namespace Concurrent
+{
+	constexpr std::size_t Trace::DEFAULT_CAPACITY;
+	
+	std::atomic<bool> Trace::_enabled{false};
+	
+	// Written only by the thread which owns it, and read by whichever thread writes the trace. The head counts every event recorded, so the slot it indexes is the next one to be overwritten.
+	struct Trace::Buffer
+	{
+		Buffer(std::size_t index_, std::size_t capacity) : index(index_), events(capacity) {}
+		
+		std::size_t index;
+		
+		std::vector<Event> events;
+		std::atomic<std::uint64_t> head{0};
+		
+		// Copy the events which are kept, oldest first. Unless the owning thread is reading, any which might have been overwritten while copying are left out:
+		std::vector<Event> read(bool owner) const
+		{
+			auto capacity = events.size();
+			auto end = head.load(std::memory_order_acquire);
+			auto begin = end > capacity ? end - capacity : 0;
+			
+			std::vector<Event> result;
+			result.reserve(end - begin);
+			
+			for (auto i = begin; i < end; i += 1) {
+				result.push_back(events[i & (capacity - 1)]);
+			}
+			
+			if (owner) return result;
+			
+			// The slot of the event being recorded now may already be partly overwritten:
+			auto current = head.load(std::memory_order_acquire);
+			
+			if (current + 1 > begin + capacity) {
+				auto overwritten = std::min<std::uint64_t>(current + 1 - capacity - begin, result.size());
+				
+				result.erase(result.begin(), result.begin() + overwritten);
+			}
+			
+			return result;
+		}
+	};
+	
+	namespace
+	{
+		// The buffers of all threads which have recorded events. They are kept once their threads exit, so that their events can still be written:
+		std::mutex buffers_lock;
+		std::vector<std::shared_ptr<Trace::Buffer>> buffers;
+		
+		std::size_t buffer_capacity = Trace::DEFAULT_CAPACITY;
+		
+		thread_local Trace::Buffer * current_buffer = nullptr;
+		
+		std::size_t round_up(std::size_t capacity)
+		{
+			std::size_t result = 1;
+			
+			while (result < capacity) result <<= 1;
+			
+			return result;
+		}
+	}
+	
+	Trace::Buffer & Trace::buffer()
+	{
+		if (current_buffer == nullptr) {
+			std::lock_guard<std::mutex> lock(buffers_lock);
+			
+			buffers.push_back(std::make_shared<Buffer>(buffers.size() + 1, buffer_capacity));
+			current_buffer = buffers.back().get();
+		}
+		
+		return *current_buffer;
+	}
+	
+	void Trace::start(std::size_t capacity)
+	{
+		{
+			std::lock_guard<std::mutex> lock(buffers_lock);
+			
+			buffer_capacity = round_up(capacity);
+			
+			for (auto & buffer : buffers) {
+				buffer->head.store(0, std::memory_order_release);
+			}
+		}
+		
+		_enabled.store(true, std::memory_order_release);
+	}
+	
+	void Trace::stop() noexcept
+	{
+		_enabled.store(false, std::memory_order_release);
+	}
+	
+	void Trace::record(Type type, const Fiber * fiber, const void * condition) noexcept
+	{
+		auto & buffer = Trace::buffer();
+		
+		auto head = buffer.head.load(std::memory_order_relaxed);
+		auto & event = buffer.events[head & (buffer.events.size() - 1)];
+		
+		event.time = std::chrono::duration_cast<std::chrono::nanoseconds>(Timer::Clock::now().time_since_epoch()).count();
+		event.type = type;
+		event.fiber = fiber;
+		event.condition = condition;
+		
+		if (fiber) {
+			std::memcpy(event.annotation, fiber->annotation(), sizeof(event.annotation));
+		} else {
+			event.annotation[0] = '\0';
+		}
+		
+		buffer.head.store(head + 1, std::memory_order_release);
+	}
+	
+	std::vector<Trace::Event> Trace::events()
+	{
+		return buffer().read(true);
+	}
+	
+	namespace
+	{
+		void write_string(std::ostream & output, const char * string)
+		{
+			output << '"';
+			
+			for (; *string; string += 1) {
+				auto character = *string;
+				
+				if (character == '"' || character == '\\') {
+					output << '\\' << character;
+				} else if (static_cast<unsigned char>(character) < 0x20) {
+					const char * digits = "0123456789abcdef";
+					output << "\\u00" << digits[character >> 4] << digits[character & 0xF];
+				} else {
+					output << character;
+				}
+			}
+			
+			output << '"';
+		}
+		
+		void write_pointer(std::ostream & output, const void * pointer)
+		{
+			output << "\"" << pointer << "\"";
+		}
+		
+		// Write the common fields of a trace event, leaving the object open for any others:
+		void write_event(std::ostream & output, bool & first, const char * phase, const char * name, std::size_t thread, std::uint64_t time)
+		{
+			output << (first ? "\n" : ",\n");
+			first = false;
+			
+			output << "{\"ph\":\"" << phase << "\",\"name\":";
+			write_string(output, name);
+			
+			// Timestamps are in microseconds:
+			output << ",\"pid\":1,\"tid\":" << thread << ",\"ts\":" << (time / 1000) << '.';
+			
+			auto fraction = time % 1000;
+			if (fraction < 100) output << '0';
+			if (fraction < 10) output << '0';
+			output << fraction;
+		}
+		
+		void write_slice(std::ostream & output, bool & first, const char * phase, const Trace::Event & event, std::size_t thread)
+		{
+			write_event(output, first, phase, event.annotation[0] ? event.annotation : "fiber", thread, event.time);
+			
+			output << ",\"args\":{\"fiber\":";
+			write_pointer(output, event.fiber);
+			output << "}}";
+		}
+		
+		void write_instant(std::ostream & output, bool & first, const char * name, const Trace::Event & event, std::size_t thread)
+		{
+			write_event(output, first, "i", name, thread, event.time);
+			
+			output << ",\"s\":\"t\",\"args\":{\"condition\":";
+			write_pointer(output, event.condition);
+			output << ",\"fiber\":";
+			write_pointer(output, event.fiber);
+			output << ",\"annotation\":";
+			write_string(output, event.annotation);
+			output << "}}";
+		}
+	}
+	
+	void Trace::write(std::ostream & output)
+	{
+		std::vector<std::shared_ptr<Buffer>> snapshot;
+		
+		{
+			std::lock_guard<std::mutex> lock(buffers_lock);
+			snapshot = buffers;
+		}
+		
+		bool first = true;
+		
+		output << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+		
+		for (auto & buffer : snapshot) {
+			auto thread = buffer->index;
+			
+			write_event(output, first, "M", "thread_name", thread, 0);
+			output << ",\"args\":{\"name\":\"thread " << thread << "\"}}";
+			
+			for (auto & event : buffer->read(buffer.get() == current_buffer)) {
+				switch (event.type) {
+					case Type::RESUME:
+						write_slice(output, first, "B", event, thread);
+						break;
+						
+					case Type::YIELD:
+					case Type::RETURN:
+						write_slice(output, first, "E", event, thread);
+						break;
+						
+					case Type::TRANSFER:
+						// The slice of the fiber which was running is ended by the most recent begin:
+						write_event(output, first, "E", "", thread, event.time);
+						output << "}";
+						write_slice(output, first, "B", event, thread);
+						break;
+						
+					case Type::WAIT:
+						write_instant(output, first, "wait", event, thread);
+						break;
+						
+					case Type::SIGNAL:
+						write_instant(output, first, "signal", event, thread);
+						break;
+						
+					case Type::BROADCAST:
+						write_instant(output, first, "resume", event, thread);
+						break;
+				}
+			}
+		}
+		
+		output << "\n]}\n";
+	}
+}
@@ -0,0 +1,103 @@
+//
+//  Trace.hpp
+//  File file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Fiber.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+namespace Concurrent
+{
+	// Records when fibers are resumed, yield, transfer and return, and when they wait on and wake conditions, so that latency spikes can be attributed to the fibers which caused them. Each thread records into its own ring buffer, which keeps the most recent events, so recording doesn't take a lock or allocate. The events can be written in the Chrome trace event format, which can be opened by chrome://tracing or Perfetto.
+	// Recording is disabled until it is started, and then each hook costs a relaxed load and a branch. Defining CONCURRENT_NO_TRACE compiles the hooks out entirely.
+	class Trace
+	{
+	public:
+		// The number of events kept by each thread.
+		static constexpr std::size_t DEFAULT_CAPACITY = 1024*64;
+		
+		enum class Type : std::uint8_t
+		{
+			// The fiber started running on this thread, or continued after being suspended:
+			RESUME,
+			
+			// The fiber suspended itself, returning to the fiber which resumed it:
+			YIELD,
+			
+			// The current fiber stopped running, and the fiber started running in its place:
+			TRANSFER,
+			
+			// The fiber finished:
+			RETURN,
+			
+			// The fiber started waiting on the condition:
+			WAIT,
+			
+			// The condition woke the fiber which had been waiting the longest:
+			SIGNAL,
+			
+			// The condition woke all of its waiters, from the fiber:
+			BROADCAST,
+		};
+		
+		struct Event
+		{
+			// Nanoseconds since the epoch of Timer::Clock:
+			std::uint64_t time;
+			
+			Type type;
+			
+			const Fiber * fiber;
+			
+			// The condition, for events which involve one:
+			const void * condition;
+			
+			// Copied from the fiber, which may no longer exist when the events are written:
+			char annotation[Fiber::ANNOTATION_SIZE];
+		};
+		
+		/// Discard any events recorded previously, and start recording. Threads which haven't recorded any events yet allocate buffers with the given capacity, rounded up to a power of two.
+		static void start(std::size_t capacity = DEFAULT_CAPACITY);
+		
+		/// Stop recording. Events which are being recorded by other threads at the same time may still be added.
+		static void stop() noexcept;
+		
+		static bool enabled() noexcept {return _enabled.load(std::memory_order_relaxed);}
+		
+		/// Record an event on the current thread, whether or not recording has been started.
+		static void record(Type type, const Fiber * fiber, const void * condition = nullptr) noexcept;
+		
+#if defined(CONCURRENT_NO_TRACE)
+		static void hook(Type type, const Fiber * fiber, const void * condition = nullptr) noexcept {}
+#else
+		// Called by fibers and conditions, to record an event if recording has been started:
+		static void hook(Type type, const Fiber * fiber, const void * condition = nullptr) noexcept
+		{
+			if (__builtin_expect(enabled(), false)) record(type, fiber, condition);
+		}
+#endif
+		
+		/// The events which the current thread has recorded and kept, oldest first.
+		static std::vector<Event> events();
+		
+		/// Write the events of all threads as a Chrome trace. Running fibers are written as slices named by their annotations, and condition events as instants. Buffers can be written while threads are still recording, in which case events being overwritten are left out.
+		static void write(std::ostream & output);
+		
+		// The ring buffer of a thread.
+		struct Buffer;
+		
+	private:
+		static Buffer & buffer();
+		
+		static std::atomic<bool> _enabled;
+	};
+}
@@ -0,0 +1,108 @@
+//
+//  Waiters.cpp
+//  File file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Waiters.hpp"
+
+#include "Scheduler.hpp"
+
+namespace Concurrent
+{
+	Waiters::~Waiters()
+	{
+		while (!_waiting.empty()) {
+			auto waiter = static_cast<Waiter *>(_waiting.next);
+			auto fiber = waiter->fiber;
+			waiter->unlink();
+			_count -= 1;
+			
+			if (!fiber) {
+				waiter->wake(*waiter, true);
+			} else if (auto scheduler = fiber->scheduler()) {
+				fiber->unpark();
+				fiber->cancel();
+				scheduler->schedule(fiber);
+			} else {
+				fiber->stop();
+			}
+		}
+	}
+	
+	Waiters::Waiter * Waiters::pop() noexcept
+	{
+		if (_waiting.empty()) return nullptr;
+		
+		auto waiter = static_cast<Waiter *>(_waiting.next);
+		waiter->unlink();
+		waiter->woken = true;
+		_count -= 1;
+		
+		if (waiter->fiber && waiter->fiber->_scheduler) waiter->fiber->unpark();
+		
+		return waiter;
+	}
+	
+	void Waiters::push(Waiter & waiter) noexcept
+	{
+		_waiting.push_back(waiter);
+		_count += 1;
+	}
+	
+	std::size_t Waiters::wake(std::size_t count, Spinlock & lock)
+	{
+		std::size_t woken = 0;
+		
+		while (woken < count) {
+			lock.lock();
+			auto waiter = pop();
+			lock.unlock();
+			
+			if (!waiter) break;
+			
+			woken += 1;
+			waiter->schedule();
+		}
+		
+		return woken;
+	}
+	
+	void Waiters::suspend(Waiter & waiter, Spinlock & lock)
+	{
+		push(waiter);
+		
+		if (waiter.fiber->scheduler()) {
+			// Once parked, request_stop can remove the waiter and make the fiber ready, from any thread:
+			Fiber::Parking parking{&lock, &waiter, &_count};
+			
+			if (!waiter.fiber->park(parking)) {
+				lock.unlock();
+				
+				return;
+			}
+			
+			// The lock is released after the fiber has been switched out, otherwise another worker could resume it while it is still running:
+			Scheduler::suspend(lock);
+		} else {
+			lock.unlock();
+			waiter.fiber->yield();
+		}
+	}
+	
+	bool Waiters::remove(Waiter & waiter, Spinlock & lock) noexcept
+	{
+		if (!waiter.linked()) return false;
+		
+		std::lock_guard<Spinlock> guard(lock);
+		
+		if (!waiter.linked()) return false;
+		
+		waiter.unlink();
+		_count -= 1;
+		
+		return true;
+	}
+}
@@ -0,0 +1,102 @@
+//
+//  Waiters.hpp
+//  File file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Fiber.hpp"
+#include "Spinlock.hpp"
+#include "Link.hpp"
+
+namespace Concurrent
+{
+	// A queue of fibers waiting on a synchronization primitive, in the order they started waiting. The queue is protected by the lock of the primitive which owns it, which must be declared before the queue. Each waiter is linked from the stack of its fiber, or the frame of its coroutine, so waiting never allocates.
+	class Waiters
+	{
+	public:
+		// A fiber or stackless coroutine waiting in the queue. Each waiting fiber has one on its stack, while awaiters embed one in the coroutine's frame.
+		struct Waiter : public Link
+		{
+			Waiter(Fiber * fiber_) noexcept : fiber(fiber_) {}
+			
+			// The waiting fiber, which is scheduled when it is woken, if any:
+			Fiber * fiber = nullptr;
+			
+			// Otherwise, invoked without the lock to wake the waiter once it has been removed. If the queue is being destroyed, stopped is true:
+			void (*wake)(Waiter & waiter, bool stopped) = nullptr;
+			
+			// Whether the waiter was removed by pop(), rather than when the queue was destroyed:
+			bool woken = false;
+			
+			/// Wake the waiter once it has been removed by pop() and the lock has been released. A coroutine is resumed on the calling stack.
+			void schedule()
+			{
+				if (fiber) {
+					fiber->schedule();
+				} else {
+					wake(*this, false);
+				}
+			}
+		};
+		
+		Waiters() noexcept {}
+		
+		// If the queue goes out of scope, all fibers waiting on it will be stopped.
+		~Waiters();
+		
+		Waiters(const Waiters & other) = delete;
+		Waiters & operator=(const Waiters & other) = delete;
+		
+		bool empty() const noexcept {return _waiting.empty();}
+		std::size_t count() const noexcept {return _count;}
+		
+		/// Suspend the current fiber until it is woken by pop(). The lock must be held, and is released before this returns. If the fiber is woken because it was asked to stop, Stop is raised, since the primitives which own a queue have no other way to report it.
+		/// @param abandoned invoked without the lock if the fiber was woken but is stopped before it can run, so that whatever it was handed can be passed on.
+		template <typename AbandonedT>
+		void wait(Spinlock & lock, AbandonedT && abandoned)
+		{
+			Waiter waiter(Fiber::current);
+			
+			try {
+				suspend(waiter, lock);
+			} catch (...) {
+				if (!remove(waiter, lock) && waiter.woken) abandoned();
+				
+				throw;
+			}
+			
+			// Woken by Fiber::request_stop rather than pop(), which may have removed the waiter already:
+			if (remove(waiter, lock) || !waiter.woken) throw Stop();
+		}
+		
+		void wait(Spinlock & lock)
+		{
+			wait(lock, []{});
+		}
+		
+		/// Wake up to the given number of fibers, in the order they started waiting. The lock must not be held, as it is taken for each fiber in turn, and released before the fiber is woken.
+		/// @returns the number of fibers which were woken.
+		std::size_t wake(std::size_t count, Spinlock & lock);
+		
+		/// Remove the waiter which has been waiting the longest. The lock must be held, and the waiter should be woken using Waiter::schedule once it has been released.
+		/// @returns nullptr if there are no waiters.
+		Waiter * pop() noexcept;
+		
+		/// Add a waiter which isn't a fiber, e.g. an awaiting coroutine, to the back of the queue. The lock must be held.
+		void push(Waiter & waiter) noexcept;
+		
+		/// Remove the waiter if it is still waiting, e.g. because its coroutine was destroyed. Once it has been removed by someone else, the lock may no longer exist, so it is not used.
+		/// @returns whether the waiter was still waiting.
+		bool remove(Waiter & waiter, Spinlock & lock) noexcept;
+		
+	private:
+		void suspend(Waiter & waiter, Spinlock & lock);
+		
+		Link _waiting;
+		std::size_t _count = 0;
+	};
+}
@@ -0,0 +1,308 @@
+//
+//  Watchdog.cpp
+//  File file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Watchdog.hpp"
+#include "Fiber.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <system_error>
+
+#if defined(__linux__) || defined(__APPLE__)
+#include <execinfo.h>
+#endif
+
+namespace Concurrent
+{
+	constexpr unsigned Watchdog::Slice::CHECK_INTERVAL;
+	constexpr std::size_t Watchdog::Slice::ANNOTATION_SIZE;
+	constexpr std::chrono::milliseconds Watchdog::DEFAULT_THRESHOLD;
+	
+	thread_local Watchdog::Slice * Watchdog::Slice::_current = nullptr;
+	
+	static_assert(Watchdog::Slice::ANNOTATION_SIZE == Fiber::ANNOTATION_SIZE, "A slice must hold the whole annotation of a fiber.");
+	
+	namespace
+	{
+		// The slices of all threads which have switched fibers. Slices are reused once their threads exit, but never freed, so that the watchdog can read them without racing the threads:
+		std::mutex slices_lock;
+		std::vector<std::unique_ptr<Watchdog::Slice>> slices;
+		
+		// The watchdog which overrunning fibers report to:
+		std::mutex instance_lock;
+		Watchdog * instance = nullptr;
+		
+		// The depth of backtraces captured by overrunning fibers:
+		constexpr int BACKTRACE_DEPTH = 64;
+		
+		std::uint64_t now() noexcept
+		{
+			return std::chrono::duration_cast<std::chrono::nanoseconds>(Timer::Clock::now().time_since_epoch()).count();
+		}
+	}
+	
+	void Watchdog::Slice::attach(Fiber * fiber)
+	{
+		// Releases the slice when the thread exits:
+		struct Release
+		{
+			~Release()
+			{
+				if (auto slice = _current) {
+					_current = nullptr;
+					
+					slice->_fiber.store(nullptr, std::memory_order_relaxed);
+					slice->_released.store(true, std::memory_order_release);
+				}
+			}
+		};
+		
+		Slice * slice = nullptr;
+		
+		{
+			std::lock_guard<std::mutex> lock(slices_lock);
+			
+			for (auto & released : slices) {
+				if (released->_released.load(std::memory_order_acquire)) {
+					slice = released.get();
+					break;
+				}
+			}
+			
+			if (slice == nullptr) {
+				slices.emplace_back(new Slice);
+				slice = slices.back().get();
+			}
+			
+			slice->_main = &Fiber::main;
+			slice->_overrun.store(0, std::memory_order_relaxed);
+			slice->_released.store(false, std::memory_order_relaxed);
+		}
+		
+		thread_local Release release;
+		(void)release;
+		
+		_current = slice;
+		
+		switched(fiber);
+	}
+	
+	void Watchdog::Slice::annotate(Fiber * fiber) noexcept
+	{
+		std::uint64_t words[ANNOTATION_SIZE / sizeof(std::uint64_t)];
+		std::memcpy(words, fiber->annotation(), ANNOTATION_SIZE);
+		
+		for (std::size_t index = 0; index < ANNOTATION_SIZE / sizeof(std::uint64_t); index += 1) {
+			_annotation[index].store(words[index], std::memory_order_relaxed);
+		}
+	}
+	
+	std::string Watchdog::Slice::annotation() const
+	{
+		char annotation[ANNOTATION_SIZE];
+		
+		for (std::size_t index = 0; index < ANNOTATION_SIZE / sizeof(std::uint64_t); index += 1) {
+			auto word = _annotation[index].load(std::memory_order_relaxed);
+			std::memcpy(annotation + index * sizeof(word), &word, sizeof(word));
+		}
+		
+		// A torn copy might not be terminated:
+		return std::string(annotation, strnlen(annotation, ANNOTATION_SIZE));
+	}
+	
+	bool Watchdog::Slice::restart() noexcept
+	{
+		_checked = _switches.load(std::memory_order_relaxed);
+		_started = now();
+		_countdown = CHECK_INTERVAL;
+		
+		return false;
+	}
+	
+	bool Watchdog::Slice::check()
+	{
+		_countdown = CHECK_INTERVAL;
+		
+		if (_overrun.load(std::memory_order_relaxed) == _checked) {
+			_overrun.store(0, std::memory_order_relaxed);
+			
+			Watchdog::report(*this);
+		}
+		
+		auto fiber = Fiber::current;
+		auto budget = fiber->budget();
+		
+		if (fiber->status() == Status::MAIN || budget == Timer::Clock::duration::zero()) return false;
+		
+		return now() - _started >= static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(budget).count());
+	}
+	
+	void Watchdog::print(const Overrun & overrun)
+	{
+		std::ostringstream output;
+		
+		output << "Fiber \"" << overrun.annotation << "\" (" << overrun.fiber << ") has been running for " << std::chrono::duration_cast<std::chrono::milliseconds>(overrun.running).count() << "ms without switching." << std::endl;
+		
+#if defined(__linux__) || defined(__APPLE__)
+		if (!overrun.backtrace.empty()) {
+			auto symbols = backtrace_symbols(overrun.backtrace.data(), overrun.backtrace.size());
+			
+			if (symbols) {
+				for (std::size_t i = 0; i < overrun.backtrace.size(); i += 1) {
+					output << "\t" << symbols[i] << std::endl;
+				}
+				
+				std::free(symbols);
+			}
+		}
+#endif
+		
+		std::cerr << output.str();
+	}
+	
+	Watchdog::Watchdog(Timer::Clock::duration threshold, Report report) : _threshold(threshold), _report(std::move(report))
+	{
+		{
+			std::lock_guard<std::mutex> lock(instance_lock);
+			
+			if (instance) {
+				throw std::system_error(EBUSY, std::generic_category(), "Watchdog::Watchdog");
+			}
+			
+			instance = this;
+		}
+		
+		{
+			std::lock_guard<std::mutex> lock(slices_lock);
+			
+			// Overruns are reported again, to this watchdog:
+			for (auto & slice : slices) {
+				slice->_observed = 0;
+				slice->_reported = 0;
+			}
+		}
+		
+		try {
+			_thread = std::thread(&Watchdog::run, this);
+		} catch (...) {
+			std::lock_guard<std::mutex> lock(instance_lock);
+			instance = nullptr;
+			
+			throw;
+		}
+	}
+	
+	Watchdog::~Watchdog()
+	{
+		{
+			std::lock_guard<std::mutex> lock(_lock);
+			_stopping = true;
+		}
+		
+		_stopped.notify_one();
+		_thread.join();
+		
+		std::lock_guard<std::mutex> lock(instance_lock);
+		instance = nullptr;
+	}
+	
+	void Watchdog::report(Slice & slice)
+	{
+		auto fiber = Fiber::current;
+		
+		Overrun overrun;
+		overrun.fiber = fiber;
+		overrun.annotation = fiber->annotation();
+		overrun.running = std::chrono::nanoseconds(now() - slice._started);
+		
+#if defined(__linux__) || defined(__APPLE__)
+		overrun.backtrace.resize(BACKTRACE_DEPTH);
+		overrun.backtrace.resize(backtrace(overrun.backtrace.data(), BACKTRACE_DEPTH));
+#endif
+		
+		std::lock_guard<std::mutex> lock(instance_lock);
+		
+		if (instance) {
+			instance->_overruns.fetch_add(1, std::memory_order_relaxed);
+			instance->_report(overrun);
+		}
+	}
+	
+	void Watchdog::run()
+	{
+		auto period = std::max<Timer::Clock::duration>(_threshold / 4, std::chrono::milliseconds(1));
+		
+		std::unique_lock<std::mutex> lock(_lock);
+		
+		while (!_stopping) {
+			_stopped.wait_for(lock, period);
+			
+			if (_stopping) break;
+			
+			lock.unlock();
+			poll(Timer::Clock::now());
+			lock.lock();
+		}
+	}
+	
+	void Watchdog::poll(Timer::Clock::time_point now)
+	{
+		std::vector<Overrun> overruns;
+		
+		{
+			std::lock_guard<std::mutex> lock(slices_lock);
+			
+			for (auto & slice : slices) {
+				auto switches = slice->_switches.load(std::memory_order_acquire);
+				
+				// The thread is switching fibers, so it isn't stalled:
+				if (switches & 1) continue;
+				
+				auto fiber = slice->_fiber.load(std::memory_order_relaxed);
+				
+				// The running time is measured from when the watchdog first saw the fiber running, so it is at most one period short:
+				if (switches != slice->_observed) {
+					slice->_observed = switches;
+					slice->_since = now;
+					
+					continue;
+				}
+				
+				// Threads which have exited, or are running their main fiber, are idle rather than stalled:
+				if (fiber == nullptr || fiber == slice->_main) continue;
+				if (slice->_reported == switches) continue;
+				
+				auto running = now - slice->_since;
+				if (running < _threshold) continue;
+				
+				// The fiber may be destroyed as soon as it switches out, so only the annotation copied into the slice is read:
+				Overrun overrun;
+				overrun.fiber = fiber;
+				overrun.annotation = slice->annotation();
+				overrun.running = running;
+				
+				// If the thread switched while the annotation was being read, it might be torn:
+				std::atomic_thread_fence(std::memory_order_acquire);
+				if (slice->_switches.load(std::memory_order_relaxed) != switches) continue;
+				
+				slice->_reported = switches;
+				slice->_overrun.store(switches, std::memory_order_relaxed);
+				
+				overruns.push_back(std::move(overrun));
+			}
+		}
+		
+		for (auto & overrun : overruns) {
+			_overruns.fetch_add(1, std::memory_order_relaxed);
+			_report(overrun);
+		}
+	}
+}
@@ -0,0 +1,162 @@
+//
+//  Watchdog.hpp
+//  File file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Timer.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Concurrent
+{
+	class Fiber;
+	
+	// Detects fibers which run for too long without switching, stalling every other fiber on their thread. Each thread counts its fiber switches, and the watchdog's own thread polls the counts, so switching doesn't read the clock and no signals are needed. A fiber is reported once its thread hasn't switched for longer than the threshold.
+	class Watchdog
+	{
+	public:
+		// The fiber switches of one thread, and the time slice of its current fiber, as measured by Fiber::maybe_yield.
+		class Slice
+		{
+		public:
+			// The number of calls to maybe_yield between reading the clock, after the first call in each slice.
+			static constexpr unsigned CHECK_INTERVAL = 32;
+			
+			/// The slice of the current thread, once it has switched fibers.
+			static Slice * current() noexcept {return _current;}
+			
+			// The size of the annotations copied from fibers, which must match Fiber::ANNOTATION_SIZE.
+			static constexpr std::size_t ANNOTATION_SIZE = 32;
+			
+			/// Publish the fiber which is now running on this thread.
+			static void switched(Fiber * fiber)
+			{
+				if (auto slice = _current) {
+					auto switches = slice->_switches.load(std::memory_order_relaxed);
+					
+					// The watchdog can't read the annotation of a fiber on another thread, as the fiber may be destroyed as soon as it switches out, so it is copied. The count is odd while it is being copied, and the watchdog discards any copy it read while the count was odd or changed:
+					if (fiber != slice->_main) {
+						slice->_switches.store(switches + 1, std::memory_order_relaxed);
+						std::atomic_thread_fence(std::memory_order_release);
+						
+						slice->annotate(fiber);
+					}
+					
+					slice->_fiber.store(fiber, std::memory_order_relaxed);
+					slice->_switches.store(switches + 2, std::memory_order_release);
+				} else {
+					attach(fiber);
+				}
+			}
+			
+			/// Whether the current fiber has run for longer than its budget. The clock is read on the first call in each slice, and then every CHECK_INTERVAL calls.
+			bool expired()
+			{
+				if (_checked != _switches.load(std::memory_order_relaxed)) return restart();
+				if (--_countdown) return false;
+				
+				return check();
+			}
+			
+		private:
+			static void attach(Fiber * fiber);
+			
+			void annotate(Fiber * fiber) noexcept;
+			std::string annotation() const;
+			
+			bool restart() noexcept;
+			bool check();
+			
+			thread_local static Slice * _current;
+			
+			// Published by the thread which owns the slice. The count of switches goes up by two for each switch:
+			std::atomic<Fiber *> _fiber{nullptr};
+			std::atomic<std::uint64_t> _switches{0};
+			
+			// The annotation of the fiber, copied in words so that the watchdog can read it while it changes:
+			std::atomic<std::uint64_t> _annotation[ANNOTATION_SIZE / sizeof(std::uint64_t)] = {};
+			
+			// The main fiber of the thread, which is idle rather than running:
+			const Fiber * _main = nullptr;
+			
+			// Whether the thread has exited, in which case the slice can be reused:
+			std::atomic<bool> _released{false};
+			
+			// The count of switches at which the watchdog reported the current fiber, which then reports a backtrace from maybe_yield:
+			std::atomic<std::uint64_t> _overrun{0};
+			
+			// Used by maybe_yield, on the owning thread:
+			std::uint64_t _checked = 0;
+			std::uint64_t _started = 0;
+			unsigned _countdown = CHECK_INTERVAL;
+			
+			// Used by the watchdog's thread:
+			std::uint64_t _observed = 0;
+			Timer::Clock::time_point _since;
+			std::uint64_t _reported = 0;
+			
+			friend class Watchdog;
+		};
+		
+		static constexpr std::chrono::milliseconds DEFAULT_THRESHOLD{100};
+		
+		struct Overrun
+		{
+			const Fiber * fiber = nullptr;
+			std::string annotation;
+			
+			// How long the fiber had been running without switching, at least:
+			Timer::Clock::duration running = Timer::Clock::duration::zero();
+			
+			// The watchdog reports an overrun as soon as it notices, without a backtrace, as it doesn't interrupt the fiber's thread. If the fiber then calls maybe_yield without switching, it reports the overrun again, with a backtrace captured from its own stack.
+			std::vector<void *> backtrace;
+		};
+		
+		// Invoked by the watchdog's thread, or by the overrunning fiber's thread, so it must be thread safe.
+		typedef std::function<void (const Overrun & overrun)> Report;
+		
+		/// Write the overrun to std::cerr, including the symbols of the backtrace.
+		static void print(const Overrun & overrun);
+		
+		/// Start watching all threads which run fibers. Only one watchdog may exist at a time.
+		/// @param threshold the longest a fiber can run without switching before it is reported.
+		Watchdog(Timer::Clock::duration threshold = DEFAULT_THRESHOLD, Report report = print);
+		~Watchdog();
+		
+		Watchdog(const Watchdog & other) = delete;
+		Watchdog & operator=(const Watchdog & other) = delete;
+		
+		/// The number of overruns which have been detected.
+		std::size_t overruns() const noexcept {return _overruns.load(std::memory_order_relaxed);}
+		
+	private:
+		// Report an overrun from the thread of the fiber, with a backtrace:
+		static void report(Slice & slice);
+		
+		void run();
+		void poll(Timer::Clock::time_point now);
+		
+		Timer::Clock::duration _threshold;
+		Report _report;
+		
+		std::atomic<std::size_t> _overruns{0};
+		
+		std::mutex _lock;
+		std::condition_variable _stopped;
+		bool _stopping = false;
+		
+		std::thread _thread;
+	};
+}
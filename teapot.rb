@@ -32,6 +32,7 @@ define_target 'concurrent-library' do |target|
 		library_path = build static_library: "Concurrent", source_files: source_root.glob('Concurrent/**/*.{cpp,c}')
 		
 		append linkflags library_path
+		append linkflags "-pthread"
 		append header_search_paths source_root
 	end
 end
@@ -49,6 +50,20 @@ define_target "concurrent-tests" do |target|
 	end
 end
 
+define_target "concurrent-benchmarks" do |target|
+	target.depends "Language/C++14"
+	
+	target.depends "Library/Concurrent"
+	
+	target.provides "Benchmark/Concurrent" do |*arguments|
+		benchmark_root = target.package.path + 'benchmark'
+		
+		executable_path = build executable: "ConcurrentBenchmark", source_files: benchmark_root.glob('Concurrent/**/*.cpp')
+		
+		run executable_file: executable_path, arguments: arguments
+	end
+end
+
 # Configurations
 
 define_configuration "development" do |configuration|
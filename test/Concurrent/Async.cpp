@@ -0,0 +1,302 @@
+//
+//  Test.Async.cpp
+//  This file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Concurrent/Async.hpp>
+
+#if defined(__cpp_impl_coroutine)
+
+#include <string>
+#include <stdexcept>
+
+namespace Concurrent
+{
+	static Async<int> add(int x, int y)
+	{
+		co_return x + y;
+	}
+	
+	static Async<int> sum()
+	{
+		int total = co_await add(1, 2);
+		total += co_await add(3, 4);
+		
+		co_return total;
+	}
+	
+	static Async<std::string> wait_and_return(Condition & condition, std::string value)
+	{
+		co_await condition;
+		
+		co_return value;
+	}
+	
+	// Coroutines must not be lambdas with captures, as the closure is destroyed while the coroutine is suspended:
+	static Async<> wait_and_append(Condition & condition, std::string & order)
+	{
+		co_await condition;
+		
+		order += "c";
+	}
+	
+	static Async<> wait_for_completion(Fiber & fiber, bool & completed)
+	{
+		co_await fiber;
+		
+		completed = true;
+	}
+	
+	static Async<int> receive_all(Channel<int> & channel)
+	{
+		int total = 0;
+		
+		while (auto value = co_await channel) total += *value;
+		
+		co_return total;
+	}
+	
+	static Async<std::size_t> send_all(Channel<int> & channel, int count)
+	{
+		std::size_t sent = 0;
+		
+		for (int value = 1; value <= count; value += 1) {
+			if (!co_await send(channel, value)) break;
+			
+			sent += 1;
+		}
+		
+		co_return sent;
+	}
+	
+	static Async<int> fail()
+	{
+		throw std::runtime_error("failed");
+		
+		co_return 0;
+	}
+	
+	UnitTest::Suite AsyncTestSuite {
+		"Concurrent::Async",
+		
+		{"it should await other coroutines",
+			[](UnitTest::Examiner & examiner) {
+				examiner.expect(sum().get()) == 10;
+			}
+		},
+		
+		{"it should wait on a condition",
+			[](UnitTest::Examiner & examiner) {
+				Condition condition;
+				
+				auto async = wait_and_return(condition, "woken");
+				async.start();
+				
+				examiner.expect(async.done()) == false;
+				examiner.expect(condition.count()) == 1;
+				
+				condition.signal();
+				
+				examiner.expect(async.done()) == true;
+				examiner.expect(async.get()) == "woken";
+			}
+		},
+		
+		{"it should wait on fibers and coroutines in order",
+			[](UnitTest::Examiner & examiner) {
+				Condition condition;
+				std::string order;
+				
+				Fiber fiber([&]{condition.wait(); order += "f";});
+				
+				auto async = wait_and_append(condition, order);
+				
+				fiber.resume();
+				async.start();
+				
+				examiner.expect(condition.count()) == 2;
+				
+				condition.resume();
+				
+				examiner.expect(order) == "fc";
+			}
+		},
+		
+		{"it should await the completion of a fiber",
+			[](UnitTest::Examiner & examiner) {
+				bool completed = false;
+				
+				Fiber fiber([&]{Fiber::current->yield();});
+				fiber.resume();
+				
+				auto async = wait_for_completion(fiber, completed);
+				
+				async.start();
+				
+				examiner.expect(completed) == false;
+				
+				fiber.resume();
+				
+				examiner.expect(completed) == true;
+			}
+		},
+		
+		{"it should block a fiber until a coroutine completes",
+			[](UnitTest::Examiner & examiner) {
+				Condition condition;
+				std::string result;
+				
+				Fiber fiber([&]{
+					result = wait_and_return(condition, "done").get();
+				});
+				
+				fiber.resume();
+				
+				examiner.expect(result) == "";
+				
+				condition.signal();
+				
+				examiner.expect(result) == "done";
+				examiner.expect(bool(fiber)) == false;
+			}
+		},
+		
+		{"it should raise exceptions where it is awaited",
+			[](UnitTest::Examiner & examiner) {
+				std::string error;
+				
+				try {
+					fail().get();
+				} catch (const std::runtime_error & exception) {
+					error = exception.what();
+				}
+				
+				examiner.expect(error) == "failed";
+			}
+		},
+		
+		{"it should receive from a channel sent to by a fiber",
+			[](UnitTest::Examiner & examiner) {
+				Channel<int> channel(2);
+				
+				auto async = receive_all(channel);
+				async.start();
+				
+				examiner.expect(async.done()) == false;
+				
+				// Each value sent by the fiber resumes the coroutine on the fiber's stack, until it waits for the next:
+				Fiber fiber([&]{
+					for (int value = 1; value <= 10; value += 1) channel.send(value);
+					
+					channel.close();
+				});
+				
+				fiber.resume();
+				
+				examiner.expect(bool(fiber)) == false;
+				examiner.expect(async.done()) == true;
+				examiner.expect(async.get()) == 55;
+			}
+		},
+		
+		{"it should send to a channel received from by a fiber",
+			[](UnitTest::Examiner & examiner) {
+				Channel<int> channel(2);
+				int total = 0;
+				
+				auto async = send_all(channel, 10);
+				async.start();
+				
+				examiner.expect(async.done()) == false;
+				examiner.expect(channel.size()) == 2;
+				
+				Fiber fiber([&]{
+					int value;
+					
+					while (channel.recv(value)) total += value;
+				});
+				
+				fiber.resume();
+				
+				examiner.expect(async.done()) == true;
+				examiner.expect(async.get()) == 10;
+				
+				channel.close();
+				
+				examiner.expect(bool(fiber)) == false;
+				examiner.expect(total) == 55;
+			}
+		},
+		
+		{"it should pass values between coroutines on the same channel",
+			[](UnitTest::Examiner & examiner) {
+				Channel<int> channel(1);
+				
+				auto receiver = receive_all(channel);
+				auto sender = send_all(channel, 100);
+				
+				receiver.start();
+				sender.start();
+				
+				examiner.expect(sender.done()) == true;
+				examiner.expect(sender.get()) == 100;
+				
+				channel.close();
+				
+				examiner.expect(receiver.done()) == true;
+				examiner.expect(receiver.get()) == 5050;
+			}
+		},
+		
+		{"it should stop sending when the channel is closed",
+			[](UnitTest::Examiner & examiner) {
+				Channel<int> channel(1);
+				
+				auto async = send_all(channel, 10);
+				async.start();
+				
+				channel.close();
+				
+				examiner.expect(async.done()) == true;
+				examiner.expect(async.get()) == 1;
+			}
+		},
+		
+		{"it should stop waiting when destroyed",
+			[](UnitTest::Examiner & examiner) {
+				Condition condition;
+				
+				{
+					auto async = wait_and_return(condition, "never");
+					async.start();
+					
+					examiner.expect(condition.count()) == 1;
+				}
+				
+				examiner.expect(condition.count()) == 0;
+			}
+		},
+		
+		{"it should stop receiving when destroyed",
+			[](UnitTest::Examiner & examiner) {
+				Channel<int> channel(1);
+				
+				{
+					auto async = receive_all(channel);
+					async.start();
+				}
+				
+				// The receiver was removed, so the value stays in the channel:
+				examiner.expect(channel.try_send(1)) == true;
+				examiner.expect(channel.size()) == 1;
+			}
+		},
+	};
+}
+
+#endif
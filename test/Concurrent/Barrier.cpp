@@ -0,0 +1,67 @@
+//
+//  Test.Barrier.cpp
+//  This file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Concurrent/Barrier.hpp>
+#include <Concurrent/Scheduler.hpp>
+
+namespace Concurrent
+{
+	UnitTest::Suite BarrierTestSuite {
+		"Concurrent::Barrier",
+		
+		{"it should wake fibers once all have arrived",
+			[](UnitTest::Examiner & examiner) {
+				Barrier barrier(3);
+				std::string order;
+				
+				Fiber first([&]{order += 'A'; barrier.arrive_and_wait(); order += 'a';});
+				Fiber second([&]{order += 'B'; barrier.arrive_and_wait(); order += 'b';});
+				
+				first.resume();
+				second.resume();
+				
+				examiner.expect(order) == "AB";
+				
+				barrier.arrive_and_wait();
+				
+				examiner.expect(order) == "ABab";
+				examiner.expect(barrier.phase()) == 1;
+			}
+		},
+		
+		{"it should keep fibers on different workers in phase",
+			[](UnitTest::Examiner & examiner) {
+				const std::size_t FIBERS = 16, PHASES = 50;
+				
+				Scheduler scheduler(4, 1024*64);
+				Barrier barrier(FIBERS);
+				std::atomic<std::size_t> arrived{0};
+				std::atomic<bool> consistent{true};
+				
+				for (std::size_t i = 0; i < FIBERS; i += 1) {
+					scheduler.spawn([&]{
+						for (std::size_t phase = 0; phase < PHASES; phase += 1) {
+							arrived += 1;
+							barrier.arrive_and_wait();
+							
+							// Every fiber has arrived for this phase, and none can have arrived for the next one until this one has passed the barrier:
+							if (arrived.load() < (phase + 1) * FIBERS) consistent = false;
+						}
+					});
+				}
+				
+				scheduler.wait();
+				
+				examiner.expect(consistent.load()) == true;
+				examiner.expect(barrier.phase()) == PHASES;
+			}
+		},
+	};
+}
@@ -0,0 +1,273 @@
+//
+//  Test.Blocking.cpp
+//  This file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Concurrent/Blocking.hpp>
+#include <Concurrent/Scheduler.hpp>
+
+#if defined(__linux__)
+
+#include <atomic>
+#include <string>
+#include <stdexcept>
+#include <thread>
+
+namespace Concurrent
+{
+	UnitTest::Suite BlockingTestSuite {
+		"Concurrent::Blocking",
+		
+		{"it should run calls from scheduled fibers on helper threads",
+			[](UnitTest::Examiner & examiner) {
+				Blocking blocking(2);
+				std::atomic<std::size_t> total{0};
+				std::atomic<std::size_t> elsewhere{0};
+				
+				{
+					Scheduler scheduler(2, 1024*64);
+					
+					for (std::size_t i = 0; i < 8; i += 1) {
+						scheduler.spawn([&, i]{
+							auto caller = std::this_thread::get_id();
+							
+							total += blocking.run([&]{
+								if (std::this_thread::get_id() != caller) elsewhere += 1;
+								
+								std::this_thread::sleep_for(std::chrono::milliseconds(1));
+								
+								return i;
+							});
+						});
+					}
+				}
+				
+				examiner.expect(total.load()) == 28;
+				examiner.expect(elsewhere.load()) == 8;
+			}
+		},
+		
+		{"it should resume fibers through the reactor of their thread",
+			[](UnitTest::Examiner & examiner) {
+				Blocking blocking(1);
+				Reactor reactor;
+				std::string result;
+				
+				Fiber fiber([&]{
+					result = blocking.run([]{
+						return std::string("done");
+					});
+				});
+				
+				fiber.resume();
+				
+				examiner.expect(reactor.count()) == 1;
+				
+				reactor.run();
+				
+				examiner.expect(result) == "done";
+				examiner.expect(reactor.count()) == 0;
+				examiner.expect(bool(fiber)) == false;
+			}
+		},
+		
+		{"it should raise exceptions in the calling fiber",
+			[](UnitTest::Examiner & examiner) {
+				Blocking blocking(1);
+				Reactor reactor;
+				std::string error;
+				
+				Fiber fiber([&]{
+					try {
+						blocking.run([]{
+							throw std::runtime_error("failed");
+						});
+					} catch (const std::runtime_error & exception) {
+						error = exception.what();
+					}
+				});
+				
+				fiber.resume();
+				reactor.run();
+				
+				examiner.expect(error) == "failed";
+			}
+		},
+		
+		{"it should detach the call when the calling fiber is stopped",
+			[](UnitTest::Examiner & examiner) {
+				std::atomic<bool> started{false};
+				bool completed = false, stopped = false;
+				
+				{
+					Blocking blocking(1);
+					Reactor reactor;
+					
+					Fiber fiber([&]{
+						try {
+							blocking.run([&]{
+								started = true;
+								std::this_thread::sleep_for(std::chrono::milliseconds(10));
+								completed = true;
+							});
+						} catch (Stop) {
+							stopped = true;
+						}
+					});
+					
+					fiber.resume();
+					
+					while (!started) std::this_thread::yield();
+					
+					fiber.stop();
+					
+					examiner.expect(stopped) == true;
+					examiner.expect(bool(fiber)) == false;
+					examiner.expect(reactor.count()) == 0;
+				}
+				
+				// The pool waits for the detached call before stopping its threads:
+				examiner.expect(completed) == true;
+			}
+		},
+		
+		{"it should not be affected by destroying fibers with calls in flight",
+			[](UnitTest::Examiner & examiner) {
+				std::atomic<bool> started{false}, finish{false};
+				bool completed = false, queued = false;
+				
+				{
+					Blocking blocking(1);
+					Reactor reactor;
+					
+					{
+						// The first call occupies the only helper thread, so the second stays queued:
+						Fiber running([&]{
+							blocking.run([&]{
+								started = true;
+								while (!finish) std::this_thread::yield();
+								completed = true;
+							});
+						});
+						
+						Fiber waiting([&]{
+							blocking.run([&]{
+								queued = true;
+							});
+						});
+						
+						running.resume();
+						waiting.resume();
+						
+						while (!started) std::this_thread::yield();
+						
+						examiner.expect(blocking.statistics().depth) == 1;
+					}
+					
+					examiner.expect(blocking.statistics().depth) == 0;
+					examiner.expect(reactor.count()) == 0;
+					
+					finish = true;
+				}
+				
+				examiner.expect(completed) == true;
+				examiner.expect(queued) == false;
+			}
+		},
+		
+		{"it should run calls directly when there is nothing else to run",
+			[](UnitTest::Examiner & examiner) {
+				Blocking blocking(1);
+				
+				auto caller = std::this_thread::get_id();
+				
+				auto callee = blocking.run([]{
+					return std::this_thread::get_id();
+				});
+				
+				examiner.expect(callee == caller) == true;
+				examiner.expect(blocking.statistics().submitted) == 0;
+			}
+		},
+		
+		{"it should suspend callers while the queue is full",
+			[](UnitTest::Examiner & examiner) {
+				Blocking blocking(1, 1);
+				Reactor reactor;
+				
+				std::atomic<bool> started{false}, finish{false};
+				std::size_t completed = 0;
+				
+				Fiber::Pool pool(1024*64);
+				
+				// The first call occupies the helper thread, and the second fills the queue:
+				pool.resume([&]{
+					blocking.run([&]{
+						started = true;
+						while (!finish) std::this_thread::yield();
+					});
+					
+					completed += 1;
+				});
+				
+				while (!started) std::this_thread::yield();
+				
+				for (std::size_t i = 0; i < 3; i += 1) {
+					pool.resume([&]{
+						blocking.run([]{});
+						
+						completed += 1;
+					});
+				}
+				
+				// The callers which found the queue full are suspended, rather than spinning until there is space:
+				auto statistics = blocking.statistics();
+				examiner.expect(statistics.depth) == 1;
+				examiner.expect(statistics.full) == 2;
+				examiner.expect(reactor.count()) == 4;
+				
+				finish = true;
+				reactor.run();
+				
+				examiner.expect(completed) == 4;
+				examiner.expect(blocking.statistics().peak_depth) == 1;
+			}
+		},
+		
+		{"it should count queued and completed calls",
+			[](UnitTest::Examiner & examiner) {
+				Blocking blocking(1, 2);
+				Reactor reactor;
+				
+				Fiber::Pool pool(1024*64);
+				
+				for (std::size_t i = 0; i < 4; i += 1) {
+					pool.resume([&]{
+						blocking.run([]{
+							std::this_thread::sleep_for(std::chrono::milliseconds(1));
+						});
+					});
+				}
+				
+				reactor.run();
+				
+				auto statistics = blocking.statistics();
+				
+				examiner.expect(statistics.threads) == 1;
+				examiner.expect(statistics.submitted) == 4;
+				examiner.expect(statistics.completed) == 4;
+				examiner.expect(statistics.depth) == 0;
+				examiner.expect(statistics.running) == 0;
+				examiner.expect(statistics.peak_depth <= 2) == true;
+				examiner.expect(statistics.executing >= std::chrono::milliseconds(4)) == true;
+			}
+		},
+	};
+}
+
+#endif
@@ -0,0 +1,159 @@
+//
+//  Test.Channel.cpp
+//  This file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Concurrent/Channel.hpp>
+#include <Concurrent/Scheduler.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace Concurrent
+{
+	UnitTest::Suite ChannelTestSuite {
+		"Concurrent::Channel",
+		
+		{"it should send and receive values in order",
+			[](UnitTest::Examiner & examiner) {
+				Channel<int> channel(2);
+				int value = 0;
+				
+				examiner.expect(channel.try_send(1)) == true;
+				examiner.expect(channel.try_send(2)) == true;
+				examiner.expect(channel.try_send(3)) == false;
+				
+				examiner.expect(channel.size()) == 2;
+				
+				examiner.expect(channel.try_recv(value)) == true;
+				examiner.expect(value) == 1;
+				
+				examiner.expect(channel.try_recv(value)) == true;
+				examiner.expect(value) == 2;
+				
+				examiner.expect(channel.try_recv(value)) == false;
+			}
+		},
+		
+		{"it should move values without copying them",
+			[](UnitTest::Examiner & examiner) {
+				Channel<std::unique_ptr<int>> channel(1);
+				std::unique_ptr<int> value;
+				
+				channel.send(std::unique_ptr<int>(new int(10)));
+				channel.recv(value);
+				
+				examiner.expect(*value) == 10;
+			}
+		},
+		
+		{"it should suspend senders while the channel is full",
+			[](UnitTest::Examiner & examiner) {
+				Channel<int> channel(1);
+				std::size_t sent = 0;
+				int value = 0;
+				
+				Fiber sender([&]{
+					for (int i = 1; i <= 3; i += 1) {
+						channel.send(i);
+						sent += 1;
+					}
+				});
+				
+				sender.resume();
+				examiner.expect(sent) == 1;
+				
+				channel.recv(value);
+				examiner.expect(value) == 1;
+				examiner.expect(sent) == 2;
+				
+				channel.recv(value);
+				channel.recv(value);
+				examiner.expect(value) == 3;
+				examiner.expect(sent) == 3;
+			}
+		},
+		
+		{"it should send and receive in batches",
+			[](UnitTest::Examiner & examiner) {
+				Channel<int> channel(4);
+				std::vector<int> input{1, 2, 3, 4, 5, 6}, output(6);
+				std::size_t received = 0;
+				
+				Fiber receiver([&]{
+					while (received < output.size()) {
+						received += channel.recv_n(output.begin() + received, output.size() - received);
+					}
+				});
+				
+				receiver.resume();
+				
+				examiner.expect(channel.send_n(input.begin(), input.size())) == 6;
+				examiner.expect(received) == 6;
+				examiner.expect(output == input) == true;
+			}
+		},
+		
+		{"it should wake receivers when closed",
+			[](UnitTest::Examiner & examiner) {
+				Channel<int> channel(4);
+				std::vector<int> values;
+				
+				Fiber receiver([&]{
+					int value;
+					
+					while (channel.recv(value)) {
+						values.push_back(value);
+					}
+				});
+				
+				receiver.resume();
+				
+				channel.send(1);
+				channel.send(2);
+				channel.close();
+				
+				examiner.expect(channel.send(3)) == false;
+				examiner.expect(values.size()) == 2;
+				examiner.expect(receiver.status()) == Status::FINISHED;
+			}
+		},
+		
+		{"it should pass values between workers",
+			[](UnitTest::Examiner & examiner) {
+				const std::size_t SENDERS = 8, VALUES = 1000;
+				
+				Scheduler scheduler(4, 1024*64);
+				Channel<std::size_t> channel(16);
+				std::atomic<std::size_t> total{0}, senders{SENDERS};
+				
+				for (std::size_t i = 0; i < SENDERS; i += 1) {
+					scheduler.spawn([&]{
+						for (std::size_t value = 1; value <= VALUES; value += 1) {
+							channel.send(value);
+						}
+						
+						if (--senders == 0) channel.close();
+					});
+				}
+				
+				for (std::size_t i = 0; i < 4; i += 1) {
+					scheduler.spawn([&]{
+						std::size_t value;
+						
+						while (channel.recv(value)) total += value;
+					});
+				}
+				
+				scheduler.wait();
+				
+				examiner.expect(total.load()) == SENDERS * VALUES * (VALUES + 1) / 2;
+			}
+		},
+	};
+}
@@ -10,6 +10,13 @@
 
 #include <Concurrent/Condition.hpp>
 #include <Concurrent/Fiber.hpp>
+#include <Concurrent/Scheduler.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
 
 namespace Concurrent
 {
@@ -35,5 +42,116 @@ namespace Concurrent
 				examiner.expect(condition.count()) == 0;
 			}
 		},
+		
+		{"it should signal waiting fibers in order",
+			[](UnitTest::Examiner & examiner) {
+				Condition condition;
+				std::string order;
+				
+				Fiber first([&]{condition.wait(); order += '1';});
+				Fiber second([&]{condition.wait(); order += '2';});
+				Fiber third([&]{condition.wait(); order += '3';});
+				
+				first.resume();
+				second.resume();
+				third.resume();
+				
+				examiner.expect(condition.count()) == 3;
+				
+				examiner.expect(condition.signal()) == true;
+				examiner.expect(order) == "1";
+				examiner.expect(condition.count()) == 2;
+				
+				condition.resume();
+				examiner.expect(order) == "123";
+				
+				examiner.expect(condition.signal()) == false;
+			}
+		},
+		
+		{"it should remove stopped fibers",
+			[](UnitTest::Examiner & examiner) {
+				Condition condition;
+				bool resumed = false;
+				
+				Fiber stopped([&]{condition.wait();});
+				Fiber waiting([&]{condition.wait(); resumed = true;});
+				
+				stopped.resume();
+				waiting.resume();
+				
+				examiner.expect(condition.count()) == 2;
+				
+				stopped.stop();
+				
+				examiner.expect(condition.count()) == 1;
+				
+				condition.signal();
+				
+				examiner.expect(resumed) == true;
+			}
+		},
+		
+		{"it should report stop requests to waiting fibers",
+			[](UnitTest::Examiner & examiner) {
+				Condition condition;
+				std::string order;
+				
+				Fiber fiber([&]{
+					while (condition.wait()) order += "w";
+					
+					order += "s";
+					
+					// Once asked to stop, the fiber doesn't wait again:
+					if (!condition.wait()) order += "s";
+				});
+				
+				fiber.resume();
+				condition.signal();
+				
+				examiner.expect(order) == "w";
+				
+				fiber.request_stop();
+				
+				examiner.expect(order) == "wss";
+				examiner.expect(condition.count()) == 0;
+				examiner.expect(bool(fiber)) == false;
+			}
+		},
+		
+		{"it should wake fibers run by a scheduler when they are asked to stop",
+			[](UnitTest::Examiner & examiner) {
+				const std::size_t FIBERS = 100;
+				
+				Scheduler scheduler(2, 1024*64);
+				Condition condition;
+				std::mutex lock;
+				std::vector<Fiber *> fibers;
+				std::atomic<std::size_t> stopped{0};
+				
+				for (std::size_t i = 0; i < FIBERS; i += 1) {
+					scheduler.spawn([&]{
+						{
+							std::lock_guard<std::mutex> guard(lock);
+							fibers.push_back(Fiber::current);
+						}
+						
+						while (condition.wait());
+						
+						stopped += 1;
+					});
+				}
+				
+				while (condition.count() < FIBERS) std::this_thread::yield();
+				
+				// Nothing signals the condition, so the fibers can only finish if the requests wake them:
+				for (auto fiber : fibers) fiber->request_stop();
+				
+				scheduler.wait();
+				
+				examiner.expect(stopped.load()) == FIBERS;
+				examiner.expect(condition.count()) == 0;
+			}
+		},
 	};
 }
@@ -0,0 +1,104 @@
+//
+//  Test.Deque.cpp
+//  This file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Concurrent/Deque.hpp>
+
+#include <thread>
+#include <atomic>
+
+namespace Concurrent
+{
+	UnitTest::Suite DequeTestSuite {
+		"Concurrent::Deque",
+		
+		{"it should pop items in reverse order",
+			[](UnitTest::Examiner & examiner) {
+				Deque<std::size_t> deque;
+				std::size_t item = 0;
+				
+				deque.push(1);
+				deque.push(2);
+				
+				examiner.expect(deque.pop(item)) == true;
+				examiner.expect(item) == 2;
+				
+				examiner.expect(deque.pop(item)) == true;
+				examiner.expect(item) == 1;
+				
+				examiner.expect(deque.pop(item)) == false;
+			}
+		},
+		
+		{"it should steal items in order",
+			[](UnitTest::Examiner & examiner) {
+				Deque<std::size_t> deque(2);
+				std::size_t item = 0;
+				
+				// Pushing more items than the initial capacity grows the deque:
+				for (std::size_t i = 0; i < 10; i += 1) {
+					deque.push(i);
+				}
+				
+				examiner.expect(deque.size()) == 10;
+				
+				examiner.expect(deque.steal(item)) == true;
+				examiner.expect(item) == 0;
+				
+				examiner.expect(deque.steal(item)) == true;
+				examiner.expect(item) == 1;
+			}
+		},
+		
+		{"it should hand out each item exactly once",
+			[](UnitTest::Examiner & examiner) {
+				const std::size_t COUNT = 100000;
+				
+				Deque<std::size_t> deque;
+				std::atomic<std::size_t> total{0}, taken{0};
+				std::atomic<bool> done{false};
+				
+				auto thief = [&]{
+					std::size_t item;
+					
+					while (!done.load() || !deque.empty()) {
+						if (deque.steal(item)) {
+							total += item;
+							taken += 1;
+						}
+					}
+				};
+				
+				std::thread first(thief), second(thief);
+				
+				std::size_t item;
+				for (std::size_t i = 1; i <= COUNT; i += 1) {
+					deque.push(i);
+					
+					if (i % 3 == 0 && deque.pop(item)) {
+						total += item;
+						taken += 1;
+					}
+				}
+				
+				done = true;
+				first.join();
+				second.join();
+				
+				while (deque.pop(item)) {
+					total += item;
+					taken += 1;
+				}
+				
+				examiner.expect(taken.load()) == COUNT;
+				examiner.expect(total.load()) == COUNT * (COUNT + 1) / 2;
+			}
+		},
+	};
+}
@@ -31,6 +31,18 @@ namespace Concurrent
 		}
 	}
 	
+	// Touch the given amount of stack, as a deep call would:
+	static void touch_stack(std::size_t size)
+	{
+		volatile char buffer[1024*16];
+		buffer[0] = 1;
+		
+		if (size > sizeof(buffer)) touch_stack(size - sizeof(buffer));
+		
+		// Prevent the recursive call from reusing this frame:
+		buffer[1] = 1;
+	}
+	
 	UnitTest::Suite FiberTestSuite {
 		"Concurrent::Fiber",
 		
@@ -102,6 +114,71 @@ namespace Concurrent
 			}
 		},
 		
+		{"it can be asked to stop at its next suspend point",
+			[](UnitTest::Examiner & examiner) {
+				int count = 0;
+				bool returned = false;
+				
+				Fiber fiber([&]{
+					do {
+						count += 1;
+					} while (Fiber::current->yield());
+					
+					returned = true;
+				});
+				
+				fiber.resume();
+				
+				examiner.expect(count) == 1;
+				examiner.expect(fiber.stop_requested()) == false;
+				
+				fiber.request_stop();
+				
+				examiner.expect(fiber.stop_requested()) == true;
+				examiner.expect(count) == 1;
+				examiner.expect(returned) == true;
+				examiner.expect(fiber.status()) == Status::FINISHED;
+			}
+		},
+		
+		{"it reports a stop request while waiting for another fiber",
+			[](UnitTest::Examiner & examiner) {
+				Condition condition;
+				bool waited = true;
+				
+				Fiber target([&]{
+					condition.wait();
+				});
+				
+				Fiber waiter([&]{
+					waited = target.wait();
+				});
+				
+				target.resume();
+				waiter.resume();
+				
+				waiter.request_stop();
+				
+				examiner.expect(waited) == false;
+				examiner.expect(waiter.status()) == Status::FINISHED;
+				examiner.expect(target.status()) == Status::RUNNING;
+				
+				condition.resume();
+				
+				examiner.expect(target.status()) == Status::FINISHED;
+				
+				// A fiber which has already finished isn't waited for:
+				Fiber late([&]{
+					waited = target.wait();
+				});
+				
+				late.resume();
+				
+				examiner.expect(waited) == true;
+				examiner.expect(late.status()) == Status::FINISHED;
+			}
+		},
+		
 		{"it should resume in a nested fiber",
 			[](UnitTest::Examiner & examiner) {
 				std::string order;
@@ -128,6 +205,125 @@ namespace Concurrent
 			}
 		},
 		
+		{"it hands off a migrating fiber once it has been switched out",
+			[](UnitTest::Examiner & examiner) {
+				struct Capture : public Fiber::Handoff
+				{
+					Fiber * fiber = nullptr;
+					bool switched = false;
+				};
+				
+				Capture capture;
+				capture.invoke = [](Fiber::Handoff & handoff, Fiber & fiber) {
+					auto & capture = static_cast<Capture &>(handoff);
+					
+					capture.fiber = &fiber;
+					capture.switched = Fiber::current != &fiber;
+				};
+				
+				std::string order;
+				
+				Fiber fiber([&]{
+					order += 'A';
+					fiber.migrate(capture);
+					order += 'C';
+				});
+				
+				fiber.resume();
+				order += 'B';
+				
+				examiner.expect(capture.fiber == &fiber) == true;
+				examiner.expect(capture.switched) == true;
+				
+				// Resumed by whoever it was handed to:
+				capture.fiber->resume();
+				
+				examiner.expect(order) == "ABC";
+				examiner.expect(fiber.status()) == Status::FINISHED;
+			}
+		},
+		
+		{"it yields from maybe_yield once it has used its budget",
+			[](UnitTest::Examiner & examiner) {
+				std::size_t resumes = 0;
+				
+				Fiber fiber([&]{
+					auto deadline = Timer::Clock::now() + std::chrono::milliseconds(20);
+					
+					while (Timer::Clock::now() < deadline) Fiber::maybe_yield();
+				});
+				
+				fiber.budget(std::chrono::milliseconds(1));
+				
+				while (fiber) {
+					fiber.resume();
+					resumes += 1;
+				}
+				
+				examiner.expect(resumes) > 2;
+			}
+		},
+		
+		{"it doesn't yield from maybe_yield without a budget",
+			[](UnitTest::Examiner & examiner) {
+				std::size_t resumes = 0;
+				
+				Fiber fiber([&]{
+					auto deadline = Timer::Clock::now() + std::chrono::milliseconds(5);
+					
+					while (Timer::Clock::now() < deadline) Fiber::maybe_yield();
+				});
+				
+				fiber.budget(Timer::Clock::duration::zero());
+				
+				while (fiber) {
+					fiber.resume();
+					resumes += 1;
+				}
+				
+				examiner.expect(resumes) == 1;
+			}
+		},
+		
+		{"it can be emplaced on its own stack",
+			[](UnitTest::Examiner & examiner) {
+				Stack stack(1024*64);
+				void * base = stack.base(), * top = stack.top();
+				
+				bool stopped = false;
+				
+				auto fiber = Fiber::emplace("emplaced", std::move(stack), [&]{
+					try {
+						Fiber::current->yield();
+					} catch (Stop) {
+						stopped = true;
+						throw;
+					}
+				});
+				
+				examiner.expect((void*)fiber > base && (void*)fiber < top) == true;
+				examiner.expect(std::string(fiber->annotation())) == "emplaced";
+				
+				fiber->resume();
+				
+				// Destroying the suspended fiber stops it, and gives back its stack:
+				stack = Fiber::destroy(fiber);
+				
+				examiner.expect(stopped) == true;
+				examiner.expect(stack.base()) == base;
+			}
+		},
+		
+		{"it truncates long annotations",
+			[](UnitTest::Examiner & examiner) {
+				Fiber fiber([]{}, 1024*64);
+				
+				fiber.annotate(std::string(Fiber::ANNOTATION_SIZE * 2, 'x'));
+				
+				examiner.expect(std::string(fiber.annotation())) == std::string(Fiber::ANNOTATION_SIZE - 1, 'x');
+			}
+		},
+		
 		{"it can allocate fibers from a pool",
 			[](UnitTest::Examiner & examiner) {
 				std::string order;
@@ -145,5 +341,122 @@ namespace Concurrent
 				examiner.expect(count) == 5;
 			}
 		},
+		
+		{"it reuses the stacks of finished fibers",
+			[](UnitTest::Examiner & examiner) {
+				Fiber::Pool pool(1024*64);
+				
+				void * first = nullptr, * second = nullptr;
+				
+				pool.resume([&]{
+					first = Fiber::current->stack().base();
+				});
+				
+				pool.resume([&]{
+					second = Fiber::current->stack().base();
+				});
+				
+				examiner.expect(second) == first;
+				examiner.expect(pool.count()) == 1;
+				
+				pool.reap();
+				
+				examiner.expect(pool.count()) == 0;
+				examiner.expect(pool.cached()) == 1;
+			}
+		},
+		
+		{"it uses the configured stack size",
+			[](UnitTest::Examiner & examiner) {
+				Fiber::Pool pool(1024*64);
+				
+				std::size_t size = 0;
+				
+				pool.resume([&]{
+					size = Fiber::current->stack().allocated_size();
+				});
+				
+				examiner.expect(size) >= 1024*64;
+				examiner.expect(size) < Fiber::DEFAULT_STACK_SIZE;
+			}
+		},
+		
+		{"it limits the number of cached stacks",
+			[](UnitTest::Examiner & examiner) {
+				Fiber::Pool pool(1024*64, 1, true);
+				Condition condition;
+				
+				for (std::size_t i = 0; i < 3; i += 1) {
+					pool.resume([&]{
+						condition.wait();
+					});
+				}
+				
+				condition.resume();
+				pool.reap();
+				
+				examiner.expect(pool.count()) == 0;
+				examiner.expect(pool.cached()) == 1;
+			}
+		},
+		
+		{"it can trim the stack of a suspended fiber",
+			[](UnitTest::Examiner & examiner) {
+				int x = 0;
+				
+				Fiber fiber([&]{
+					touch_stack(1024*256);
+					Fiber::current->yield();
+					
+					// Trimmed pages are zero-filled when the fiber needs them again:
+					touch_stack(1024*256);
+					x = 10;
+				}, 1024*1024);
+				
+				fiber.resume();
+				examiner.expect(fiber.stack().used()) >= 1024*256;
+				
+				examiner.expect(fiber.trim()) >= 1024*256;
+				examiner.expect(fiber.stack().used()) < 1024*64;
+				
+				fiber.resume();
+				examiner.expect(x) == 10;
+			}
+		},
+		
+		{"it trims fibers in a pool which have been idle",
+			[](UnitTest::Examiner & examiner) {
+				Fiber::Pool pool(1024*1024);
+				Condition idle, busy;
+				
+				auto & first = pool.resume([&]{
+					touch_stack(1024*256);
+					idle.wait();
+				});
+				
+				auto & second = pool.resume([&]{
+					touch_stack(1024*256);
+					busy.wait();
+					touch_stack(1024*256);
+					busy.wait();
+				});
+				
+				// Both fibers ran since they were last checked:
+				examiner.expect(pool.trim(std::chrono::seconds(0))) == 0;
+				
+				busy.resume();
+				
+				examiner.expect(pool.trim(std::chrono::seconds(0))) >= 1024*256;
+				examiner.expect(first.stack().used()) < 1024*64;
+				examiner.expect(second.stack().used()) >= 1024*256;
+				
+				// The idle fiber was already trimmed:
+				examiner.expect(pool.trim(std::chrono::seconds(0))) >= 1024*256;
+				examiner.expect(pool.trim(std::chrono::hours(1))) == 0;
+				
+				idle.resume();
+				busy.resume();
+			}
+		},
 	};
 }
@@ -0,0 +1,71 @@
+//
+//  Test.Latch.cpp
+//  This file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Concurrent/Latch.hpp>
+#include <Concurrent/Scheduler.hpp>
+
+namespace Concurrent
+{
+	UnitTest::Suite LatchTestSuite {
+		"Concurrent::Latch",
+		
+		{"it should wake waiting fibers when the count reaches zero",
+			[](UnitTest::Examiner & examiner) {
+				Latch latch(2);
+				std::size_t woken = 0;
+				
+				Fiber first([&]{latch.wait(); woken += 1;});
+				Fiber second([&]{latch.wait(); woken += 1;});
+				
+				first.resume();
+				second.resume();
+				
+				latch.count_down();
+				examiner.expect(woken) == 0;
+				examiner.expect(latch.try_wait()) == false;
+				
+				latch.count_down();
+				examiner.expect(woken) == 2;
+				examiner.expect(latch.try_wait()) == true;
+			}
+		},
+		
+		{"it should wait for a group of fibers on different workers",
+			[](UnitTest::Examiner & examiner) {
+				Scheduler scheduler(4, 1024*64);
+				WaitGroup group;
+				std::atomic<std::size_t> finished{0};
+				bool complete = false;
+				
+				scheduler.spawn([&]{
+					for (std::size_t round = 0; round < 2; round += 1) {
+						group.add(10);
+						
+						for (std::size_t i = 0; i < 10; i += 1) {
+							Fiber::current->scheduler()->spawn([&]{
+								Scheduler::yield();
+								finished += 1;
+								group.done();
+							});
+						}
+						
+						group.wait();
+					}
+					
+					complete = finished == 20;
+				});
+				
+				scheduler.wait();
+				
+				examiner.expect(complete) == true;
+			}
+		},
+	};
+}
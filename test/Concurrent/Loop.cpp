@@ -0,0 +1,106 @@
+//
+//  Test.Loop.cpp
+//  This file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Concurrent/Loop.hpp>
+#include <Concurrent/Fiber.hpp>
+#include <Concurrent/Condition.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace Concurrent
+{
+	UnitTest::Suite LoopTestSuite {
+		"Concurrent::Loop",
+		
+		{"it should defer wakeups until the loop runs",
+			[](UnitTest::Examiner & examiner) {
+				Loop loop;
+				Condition condition;
+				std::string order;
+				
+				Fiber::Pool pool(1024*64);
+				
+				for (char name : {'a', 'b', 'c'}) {
+					pool.resume([&, name]{
+						condition.wait();
+						order += name;
+					});
+				}
+				
+				condition.resume();
+				
+				examiner.expect(order) == "";
+				examiner.expect(loop.empty()) == false;
+				
+				examiner.expect(loop.run()) == 3;
+				examiner.expect(order) == "abc";
+			}
+		},
+		
+		{"it should not nest fibers which wake each other",
+			[](UnitTest::Examiner & examiner) {
+				const std::size_t COUNT = 100;
+				
+				Loop loop;
+				std::vector<std::unique_ptr<Condition>> conditions;
+				std::size_t deepest = 0, count = 0;
+				
+				for (std::size_t i = 0; i <= COUNT; i += 1) {
+					conditions.emplace_back(new Condition);
+				}
+				
+				Fiber::Pool pool(1024*64);
+				
+				// Each fiber wakes the next one, which would otherwise be resumed on its stack:
+				for (std::size_t i = 0; i < COUNT; i += 1) {
+					pool.resume([&, i]{
+						conditions[i]->wait();
+						
+						deepest = std::max(deepest, Fiber::level);
+						count += 1;
+						
+						conditions[i+1]->signal();
+					});
+				}
+				
+				conditions[0]->signal();
+				loop.run();
+				
+				examiner.expect(count) == COUNT;
+				examiner.expect(deepest) == 1;
+			}
+		},
+		
+		{"it should not resume fibers which were destroyed while ready",
+			[](UnitTest::Examiner & examiner) {
+				Loop loop;
+				Condition condition;
+				bool resumed = false;
+				
+				{
+					Fiber fiber([&]{
+						condition.wait();
+						resumed = true;
+					}, 1024*64);
+					
+					fiber.resume();
+					condition.signal();
+					
+					examiner.expect(loop.empty()) == false;
+				}
+				
+				examiner.expect(loop.empty()) == true;
+				examiner.expect(loop.run()) == 0;
+				examiner.expect(resumed) == false;
+			}
+		},
+	};
+}
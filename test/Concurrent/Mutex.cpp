@@ -0,0 +1,105 @@
+//
+//  Test.Mutex.cpp
+//  This file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Concurrent/Mutex.hpp>
+#include <Concurrent/Scheduler.hpp>
+
+namespace Concurrent
+{
+	UnitTest::Suite MutexTestSuite {
+		"Concurrent::Mutex",
+		
+		{"it should lock and unlock without contention",
+			[](UnitTest::Examiner & examiner) {
+				Mutex mutex;
+				
+				examiner.expect(mutex.try_lock()) == true;
+				examiner.expect(mutex.try_lock()) == false;
+				
+				mutex.unlock();
+				
+				examiner.expect(mutex.try_lock()) == true;
+				mutex.unlock();
+			}
+		},
+		
+		{"it should hand ownership to waiting fibers in order",
+			[](UnitTest::Examiner & examiner) {
+				Mutex mutex;
+				std::string order;
+				
+				mutex.lock();
+				
+				Fiber first([&]{mutex.lock(); order += '1'; mutex.unlock();});
+				Fiber second([&]{mutex.lock(); order += '2'; mutex.unlock();});
+				
+				first.resume();
+				second.resume();
+				
+				examiner.expect(mutex.count()) == 2;
+				
+				mutex.unlock();
+				
+				examiner.expect(order) == "12";
+				examiner.expect(mutex.count()) == 0;
+				examiner.expect(mutex.try_lock()) == true;
+				
+				mutex.unlock();
+			}
+		},
+		
+		{"it should remove stopped fibers from the queue",
+			[](UnitTest::Examiner & examiner) {
+				Mutex mutex;
+				bool locked = false;
+				
+				mutex.lock();
+				
+				Fiber stopped([&]{mutex.lock(); mutex.unlock();});
+				Fiber waiting([&]{mutex.lock(); locked = true; mutex.unlock();});
+				
+				stopped.resume();
+				waiting.resume();
+				
+				stopped.stop();
+				
+				examiner.expect(mutex.count()) == 1;
+				
+				mutex.unlock();
+				
+				examiner.expect(locked) == true;
+			}
+		},
+		
+		{"it should exclude fibers on different workers",
+			[](UnitTest::Examiner & examiner) {
+				Scheduler scheduler(4, 1024*64);
+				Mutex mutex;
+				std::size_t count = 0;
+				
+				for (std::size_t i = 0; i < 100; i += 1) {
+					scheduler.spawn([&]{
+						for (std::size_t j = 0; j < 100; j += 1) {
+							std::lock_guard<Mutex> lock(mutex);
+							
+							count += 1;
+							
+							if (j % 10 == 0) Scheduler::yield();
+						}
+					});
+				}
+				
+				scheduler.wait();
+				
+				examiner.expect(count) == 10000;
+			}
+		},
+	};
+}
@@ -0,0 +1,142 @@
+//
+//  Test.Notification.cpp
+//  This file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Concurrent/Notification.hpp>
+#include <Concurrent/Fiber.hpp>
+
+#if defined(__linux__)
+
+#include <thread>
+
+namespace Concurrent
+{
+	UnitTest::Suite NotificationTestSuite {
+		"Concurrent::Notification",
+		
+		{"it should wake a fiber from another thread",
+			[](UnitTest::Examiner & examiner) {
+				Reactor reactor;
+				Condition condition;
+				Notification notification(condition);
+				bool woken = false;
+				
+				Fiber fiber([&]{
+					condition.wait();
+					woken = true;
+				});
+				
+				fiber.resume();
+				
+				std::thread thread([&]{
+					notification.signal();
+				});
+				
+				while (!woken) {
+					reactor.update();
+				}
+				
+				thread.join();
+				
+				examiner.expect(woken) == true;
+				examiner.expect(condition.count()) == 0;
+			}
+		},
+		
+		{"it should coalesce a burst of signals",
+			[](UnitTest::Examiner & examiner) {
+				Reactor reactor;
+				Condition condition;
+				Notification notification(condition);
+				std::size_t woken = 0;
+				
+				Fiber::Pool pool(1024*64);
+				
+				for (std::size_t i = 0; i < 4; i += 1) {
+					pool.resume([&]{
+						condition.wait();
+						woken += 1;
+					});
+				}
+				
+				std::thread thread([&]{
+					for (std::size_t i = 0; i < 3; i += 1) {
+						notification.signal();
+					}
+				});
+				
+				thread.join();
+				
+				examiner.expect(notification.pending()) == true;
+				examiner.expect(reactor.wakeups()) == 1;
+				
+				reactor.update(0);
+				
+				examiner.expect(notification.pending()) == false;
+				examiner.expect(woken) == 3;
+				examiner.expect(condition.count()) == 1;
+				
+				condition.resume();
+			}
+		},
+		
+		{"it should resume all waiting fibers",
+			[](UnitTest::Examiner & examiner) {
+				Reactor reactor;
+				Condition condition;
+				Notification notification(condition, reactor);
+				std::size_t woken = 0;
+				
+				Fiber::Pool pool(1024*64);
+				
+				for (std::size_t i = 0; i < 4; i += 1) {
+					pool.resume([&]{
+						condition.wait();
+						woken += 1;
+					});
+				}
+				
+				std::thread thread([&]{
+					notification.signal();
+					notification.resume();
+				});
+				
+				thread.join();
+				reactor.update(0);
+				
+				examiner.expect(woken) == 4;
+			}
+		},
+		
+		{"it should run a pending notification when destroyed",
+			[](UnitTest::Examiner & examiner) {
+				Reactor reactor;
+				Condition condition;
+				bool woken = false;
+				
+				Fiber fiber([&]{
+					condition.wait();
+					woken = true;
+				});
+				
+				fiber.resume();
+				
+				{
+					Notification notification(condition);
+					
+					std::thread([&]{notification.signal();}).join();
+				}
+				
+				examiner.expect(woken) == true;
+			}
+		},
+	};
+}
+
+#endif
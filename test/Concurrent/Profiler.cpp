@@ -0,0 +1,111 @@
+//
+//  Test.Profiler.cpp
+//  This file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Concurrent/Profiler.hpp>
+
+#if defined(__linux__)
+
+#include <sstream>
+#include <string>
+
+namespace Concurrent
+{
+	// Use the CPU until the given number of samples have been taken, or a second has passed:
+	static void spin(std::size_t count)
+	{
+		auto deadline = Timer::Clock::now() + std::chrono::seconds(1);
+		volatile std::size_t counter = 0;
+		
+		while (Profiler::samples().size() + Profiler::dropped() < count && Timer::Clock::now() < deadline) {
+			for (std::size_t i = 0; i < 100000; i += 1) counter = counter + 1;
+		}
+	}
+	
+	UnitTest::Suite ProfilerTestSuite {
+		"Concurrent::Profiler",
+		
+		{"it should attribute samples to the current fiber",
+			[](UnitTest::Examiner & examiner) {
+				Profiler::start(1000);
+				
+				Fiber fiber("spinner", [&]{
+					spin(10);
+				});
+				
+				fiber.resume();
+				
+				Profiler::stop();
+				
+				examiner.expect(Profiler::running()) == false;
+				
+				std::size_t count = 0;
+				
+				for (auto & sample : Profiler::samples()) {
+					examiner.expect(sample.depth) >= 1;
+					
+					if (sample.fiber == &fiber) {
+						examiner.expect(std::string(sample.annotation)) == "spinner";
+						count += 1;
+					}
+				}
+				
+				examiner.expect(count) > 0;
+			}
+		},
+		
+		{"it should write folded stacks",
+			[](UnitTest::Examiner & examiner) {
+				Profiler::start(1000);
+				
+				Fiber fiber("spinner", [&]{
+					spin(10);
+				});
+				
+				fiber.resume();
+				
+				Profiler::stop();
+				
+				std::stringstream output;
+				Profiler::write(output);
+				
+				std::size_t total = 0, spinner = 0;
+				std::string line;
+				
+				while (std::getline(output, line)) {
+					auto space = line.rfind(' ');
+					examiner.expect(space) != std::string::npos;
+					
+					auto count = std::stoul(line.substr(space + 1));
+					total += count;
+					
+					if (line.compare(0, 8, "spinner;") == 0) spinner += count;
+				}
+				
+				examiner.expect(total) == Profiler::samples().size();
+				examiner.expect(spinner) > 0;
+			}
+		},
+		
+		{"it should drop samples once the buffer is full",
+			[](UnitTest::Examiner & examiner) {
+				Profiler::start(1000, 1);
+				
+				spin(3);
+				
+				Profiler::stop();
+				
+				examiner.expect(Profiler::samples().size()) == 1;
+				examiner.expect(Profiler::dropped()) > 0;
+			}
+		},
+	};
+}
+
+#endif
@@ -0,0 +1,238 @@
+//
+//  Test.Queue.cpp
+//  This file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Concurrent/Queue.hpp>
+
+#include <thread>
+#include <vector>
+
+#include <time.h>
+
+namespace Concurrent
+{
+	UnitTest::Suite QueueTestSuite {
+		"Concurrent::Queue",
+		
+		{"it should send and receive values in order",
+			[](UnitTest::Examiner & examiner) {
+				Queue<int> queue(3);
+				int value = 0;
+				
+				examiner.expect(queue.capacity()) == 4;
+				examiner.expect(Queue<int>(1).capacity()) == 2;
+				
+				for (int i = 1; i <= 4; i += 1) {
+					examiner.expect(queue.try_send(i)) == true;
+				}
+				
+				examiner.expect(queue.try_send(5)) == false;
+				
+				for (int i = 1; i <= 4; i += 1) {
+					examiner.expect(queue.try_recv(value)) == true;
+					examiner.expect(value) == i;
+				}
+				
+				examiner.expect(queue.try_recv(value)) == false;
+			}
+		},
+		
+		{"it should wake fibers when other threads send values",
+			[](UnitTest::Examiner & examiner) {
+				const std::size_t THREADS = 4, VALUES = 10000;
+				
+				Scheduler scheduler(2, 1024*64);
+				Queue<std::size_t> queue(64);
+				std::atomic<std::size_t> total{0};
+				
+				for (std::size_t i = 0; i < 2; i += 1) {
+					scheduler.spawn([&]{
+						std::size_t value;
+						
+						while (queue.recv(value)) total += value;
+					});
+				}
+				
+				std::vector<std::thread> threads;
+				
+				for (std::size_t i = 0; i < THREADS; i += 1) {
+					threads.emplace_back([&]{
+						for (std::size_t value = 1; value <= VALUES; value += 1) {
+							queue.send(value);
+						}
+					});
+				}
+				
+				for (auto & thread : threads) thread.join();
+				
+				queue.close();
+				scheduler.wait();
+				
+				examiner.expect(total.load()) == THREADS * VALUES * (VALUES + 1) / 2;
+			}
+		},
+		
+		{"it should block sending threads without spinning while the queue is full",
+			[](UnitTest::Examiner & examiner) {
+				Queue<int> queue(2);
+				timespec used = {0, 0};
+				int value = 0;
+				
+				queue.try_send(0);
+				queue.try_send(1);
+				
+				std::thread thread([&]{
+					queue.send(2);
+					
+					clock_gettime(CLOCK_THREAD_CPUTIME_ID, &used);
+				});
+				
+				std::this_thread::sleep_for(std::chrono::milliseconds(100));
+				
+				examiner.expect(queue.try_recv(value)) == true;
+				examiner.expect(value) == 0;
+				
+				thread.join();
+				
+				queue.try_recv(value);
+				examiner.expect(queue.try_recv(value)) == true;
+				examiner.expect(value) == 2;
+				
+				// A thread which spun would have used the processor for most of the time it waited:
+				examiner.expect(used.tv_sec == 0 && used.tv_nsec < 20*1000*1000) == true;
+			}
+		},
+		
+		{"it should wake blocked senders when the queue is closed",
+			[](UnitTest::Examiner & examiner) {
+				Queue<int> queue(2);
+				bool sent = true;
+				
+				queue.try_send(0);
+				queue.try_send(1);
+				
+				std::thread thread([&]{
+					sent = queue.send(2);
+				});
+				
+				std::this_thread::sleep_for(std::chrono::milliseconds(10));
+				
+				queue.close();
+				thread.join();
+				
+				examiner.expect(sent) == false;
+			}
+		},
+		
+		{"it should suspend sending fibers run by a scheduler while the queue is full",
+			[](UnitTest::Examiner & examiner) {
+				const std::size_t VALUES = 1000;
+				
+				// A single worker runs both fibers, so the receiver only runs while the sender is suspended:
+				Scheduler scheduler(1, 1024*64);
+				Queue<std::size_t> queue(2);
+				std::size_t total = 0;
+				
+				scheduler.spawn([&]{
+					for (std::size_t value = 1; value <= VALUES; value += 1) {
+						queue.send(value);
+					}
+					
+					queue.close();
+				});
+				
+				scheduler.spawn([&]{
+					std::size_t value;
+					
+					while (queue.recv(value)) total += value;
+				});
+				
+				scheduler.wait();
+				
+				examiner.expect(total) == VALUES * (VALUES + 1) / 2;
+			}
+		},
+		
+#if defined(__linux__)
+		{"it should suspend sending fibers run by a reactor while the queue is full",
+			[](UnitTest::Examiner & examiner) {
+				Reactor reactor;
+				Queue<int> queue(2);
+				bool sent = false, other = false;
+				int value = 0;
+				
+				queue.try_send(0);
+				queue.try_send(1);
+				
+				Fiber sender([&]{
+					sent = queue.send(2);
+				});
+				
+				Fiber fiber([&]{
+					other = true;
+				});
+				
+				sender.resume();
+				fiber.resume();
+				
+				examiner.expect(sent) == false;
+				examiner.expect(other) == true;
+				examiner.expect(reactor.count()) == 1;
+				
+				std::thread thread([&]{
+					queue.try_recv(value);
+				});
+				
+				thread.join();
+				reactor.run();
+				
+				examiner.expect(value) == 0;
+				examiner.expect(sent) == true;
+				examiner.expect(bool(sender)) == false;
+			}
+		},
+		
+		{"it should pass on space when a sending fiber is stopped",
+			[](UnitTest::Examiner & examiner) {
+				Reactor reactor;
+				Queue<int> queue(2);
+				bool first = false, second = false;
+				int value = 0;
+				
+				queue.try_send(0);
+				queue.try_send(1);
+				
+				Fiber a([&]{
+					first = queue.send(2);
+				});
+				
+				Fiber b([&]{
+					second = queue.send(3);
+				});
+				
+				a.resume();
+				b.resume();
+				
+				// The first sender is woken, but stopped before the reactor resumes it:
+				queue.try_recv(value);
+				a.stop();
+				
+				reactor.run();
+				
+				examiner.expect(first) == false;
+				examiner.expect(second) == true;
+				
+				queue.try_recv(value);
+				examiner.expect(queue.try_recv(value)) == true;
+				examiner.expect(value) == 3;
+			}
+		},
+#endif
+	};
+}
@@ -0,0 +1,271 @@
+//
+//  Test.Reactor.cpp
+//  This file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Concurrent/Reactor.hpp>
+#include <Concurrent/Fiber.hpp>
+
+#if defined(__linux__)
+
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/socket.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+
+namespace Concurrent
+{
+	static void set_non_blocking(int descriptor)
+	{
+		::fcntl(descriptor, F_SETFL, ::fcntl(descriptor, F_GETFL) | O_NONBLOCK);
+	}
+	
+	UnitTest::Suite ReactorTestSuite {
+		"Concurrent::Reactor",
+		
+		{"it should wait until a pipe is readable",
+			[](UnitTest::Examiner & examiner) {
+				Reactor reactor;
+				int pipe[2];
+				
+				examiner.expect(::pipe(pipe)) == 0;
+				set_non_blocking(pipe[0]);
+				
+				std::string message;
+				
+				Fiber reader([&]{
+					char buffer[32];
+					
+					while (true) {
+						auto result = ::read(pipe[0], buffer, sizeof(buffer));
+						
+						if (result > 0) {
+							message.append(buffer, result);
+						} else if (result == 0) {
+							break;
+						} else {
+							reactor.wait_readable(pipe[0]);
+						}
+					}
+				});
+				
+				reader.resume();
+				examiner.expect(reactor.count()) == 1;
+				
+				::write(pipe[1], "Hello", 5);
+				reactor.update();
+				
+				examiner.expect(message) == "Hello";
+				examiner.expect(reactor.count()) == 1;
+				
+				::write(pipe[1], " World", 6);
+				::close(pipe[1]);
+				reactor.run();
+				
+				examiner.expect(message) == "Hello World";
+				examiner.expect(reader.status()) == Status::FINISHED;
+				
+				reactor.remove(pipe[0]);
+				::close(pipe[0]);
+			}
+		},
+		
+		{"it should wait until a socket is writable",
+			[](UnitTest::Examiner & examiner) {
+				Reactor reactor;
+				int sockets[2];
+				
+				examiner.expect(::socketpair(AF_UNIX, SOCK_STREAM, 0, sockets)) == 0;
+				set_non_blocking(sockets[0]);
+				set_non_blocking(sockets[1]);
+				
+				char buffer[4096] = {0};
+				std::size_t written = 0;
+				
+				// Fill the socket buffer:
+				while (::write(sockets[0], buffer, sizeof(buffer)) > 0) {}
+				
+				Fiber writer([&]{
+					reactor.wait_writable(sockets[0]);
+					written = ::write(sockets[0], buffer, sizeof(buffer));
+				});
+				
+				writer.resume();
+				examiner.expect(reactor.count()) == 1;
+				
+				// Drain the socket buffer:
+				while (::read(sockets[1], buffer, sizeof(buffer)) > 0) {}
+				
+				reactor.run();
+				
+				examiner.expect(written) == sizeof(buffer);
+				
+				reactor.remove(sockets[0]);
+				::close(sockets[0]);
+				::close(sockets[1]);
+			}
+		},
+		
+		{"it should remember readiness until waited on",
+			[](UnitTest::Examiner & examiner) {
+				Reactor reactor;
+				int sockets[2];
+				
+				examiner.expect(::socketpair(AF_UNIX, SOCK_STREAM, 0, sockets)) == 0;
+				
+				bool waited = false;
+				
+				Fiber fiber([&]{
+					reactor.wait_writable(sockets[0]);
+					reactor.wait_readable(sockets[0]);
+					waited = true;
+				});
+				
+				fiber.resume();
+				
+				::write(sockets[1], "x", 1);
+				
+				// Both edges are delivered in the same batch, but only one fiber is waiting:
+				examiner.expect(reactor.update()) == 1;
+				examiner.expect(waited) == true;
+				
+				reactor.remove(sockets[0]);
+				::close(sockets[0]);
+				::close(sockets[1]);
+			}
+		},
+		
+		{"it should run until sleeping fibers are resumed",
+			[](UnitTest::Examiner & examiner) {
+				Reactor reactor;
+				bool done = false;
+				
+				Fiber fiber([&]{
+					Fiber::sleep(std::chrono::milliseconds(5));
+					done = true;
+				});
+				
+				fiber.resume();
+				reactor.run();
+				
+				examiner.expect(done) == true;
+			}
+		},
+		
+		{"it should stop fibers waiting on removed descriptors",
+			[](UnitTest::Examiner & examiner) {
+				Reactor reactor;
+				int pipe[2];
+				
+				examiner.expect(::pipe(pipe)) == 0;
+				
+				bool stopped = false;
+				
+				Fiber fiber([&]{
+					try {
+						reactor.wait_readable(pipe[0]);
+					} catch (Stop) {
+						stopped = true;
+					}
+				});
+				
+				fiber.resume();
+				reactor.remove(pipe[0]);
+				
+				examiner.expect(stopped) == true;
+				examiner.expect(reactor.count()) == 0;
+				
+				::close(pipe[0]);
+				::close(pipe[1]);
+			}
+		},
+		
+		{"it should run tasks posted from other threads in order",
+			[](UnitTest::Examiner & examiner) {
+				struct Append : public Reactor::Task
+				{
+					std::string * order;
+					char value;
+				};
+				
+				Reactor reactor;
+				std::string order;
+				Append tasks[3];
+				
+				std::thread thread([&]{
+					for (std::size_t i = 0; i < 3; i += 1) {
+						tasks[i].order = &order;
+						tasks[i].value = 'a' + i;
+						tasks[i].invoke = [](Reactor::Task & task) {
+							auto & append = static_cast<Append &>(task);
+							*append.order += append.value;
+						};
+						
+						reactor.post(tasks[i]);
+					}
+				});
+				
+				thread.join();
+				
+				// The burst of posts rings the doorbell once:
+				examiner.expect(reactor.wakeups()) == 1;
+				
+				reactor.update(0);
+				
+				examiner.expect(order) == "abc";
+			}
+		},
+		
+		{"it should move a fiber to another thread and back",
+			[](UnitTest::Examiner & examiner) {
+				Reactor home;
+				Reactor * remote = nullptr;
+				std::atomic<bool> ready{false}, done{false};
+				
+				std::thread thread([&]{
+					Reactor reactor;
+					remote = &reactor;
+					ready = true;
+					
+					while (!done) reactor.update(10);
+				});
+				
+				while (!ready) std::this_thread::yield();
+				
+				// Thread identifiers such as std::this_thread::get_id() may be cached by the compiler across the move, so the current reactor identifies the thread:
+				Reactor * started = nullptr, * moved = nullptr, * returned = nullptr;
+				
+				Fiber fiber([&]{
+					started = Reactor::current();
+					
+					remote->enter();
+					moved = Reactor::current();
+					
+					home.enter();
+					returned = Reactor::current();
+				});
+				
+				fiber.resume();
+				
+				while (fiber) home.update(10);
+				
+				done = true;
+				thread.join();
+				
+				examiner.expect(started == &home) == true;
+				examiner.expect(moved == remote) == true;
+				examiner.expect(returned == &home) == true;
+			}
+		},
+	};
+}
+
+#endif
@@ -0,0 +1,129 @@
+//
+//  Test.Registry.cpp
+//  This file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Concurrent/Fiber.hpp>
+
+#include <memory>
+#include <thread>
+
+namespace Concurrent
+{
+	// The registry's description of the given fiber, if it is registered:
+	static bool find(const Fiber & fiber, Registry::Entry & result)
+	{
+		for (auto & entry : Registry::snapshot()) {
+			if (entry.fiber == &fiber) {
+				result = entry;
+				return true;
+			}
+		}
+		
+		return false;
+	}
+	
+	UnitTest::Suite RegistryTestSuite {
+		"Concurrent::Registry",
+		
+		{"it should list live fibers",
+			[](UnitTest::Examiner & examiner) {
+				Registry::enable();
+				
+				auto count = Registry::count();
+				
+				Registry::Entry entry;
+				
+				{
+					Fiber fiber("worker", [&]{
+						Fiber::current->yield();
+					});
+					
+					examiner.expect(Registry::count()) == count + 1;
+					
+					fiber.resume();
+					
+					examiner.expect(find(fiber, entry)) == true;
+					examiner.expect(entry.annotation) == "worker";
+					examiner.expect(entry.status == Status::RUNNING) == true;
+					examiner.expect(entry.stack_used) > 0;
+					examiner.expect(entry.stack_used) <= entry.stack_size;
+					
+					fiber.resume();
+				}
+				
+				Registry::disable();
+				
+				examiner.expect(Registry::count()) == count;
+			}
+		},
+		
+		{"it should not register fibers while disabled",
+			[](UnitTest::Examiner & examiner) {
+				Fiber fiber([&]{});
+				
+				Registry::Entry entry;
+				examiner.expect(find(fiber, entry)) == false;
+				
+				fiber.resume();
+			}
+		},
+		
+		{"it should account for time spent running and waiting",
+			[](UnitTest::Examiner & examiner) {
+				Registry::enable();
+				
+				Fiber fiber([&]{
+					std::this_thread::sleep_for(std::chrono::milliseconds(2));
+					Fiber::current->yield();
+				});
+				
+				Registry::disable();
+				
+				fiber.resume();
+				std::this_thread::sleep_for(std::chrono::milliseconds(2));
+				fiber.resume();
+				
+				Registry::Entry entry;
+				examiner.expect(find(fiber, entry)) == true;
+				
+				examiner.expect(entry.switches) == 2;
+				examiner.expect(entry.running >= std::chrono::milliseconds(2)) == true;
+				examiner.expect(entry.waiting >= std::chrono::milliseconds(2)) == true;
+			}
+		},
+		
+		{"it should list fibers created on other threads",
+			[](UnitTest::Examiner & examiner) {
+				Registry::enable();
+				
+				std::unique_ptr<Fiber> fiber;
+				
+				std::thread thread([&]{
+					fiber.reset(new Fiber("remote", [&]{}));
+				});
+				
+				thread.join();
+				
+				Registry::disable();
+				
+				const Fiber * remote = fiber.get();
+				
+				Registry::Entry entry;
+				examiner.expect(find(*remote, entry)) == true;
+				examiner.expect(entry.annotation) == "remote";
+				examiner.expect(entry.status == Status::READY) == true;
+				
+				// Fibers may be destroyed by a different thread:
+				fiber.reset();
+				
+				examiner.expect(find(*remote, entry)) == false;
+			}
+		},
+	};
+}
@@ -0,0 +1,222 @@
+//
+//  Test.Ring.cpp
+//  This file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Concurrent/Ring.hpp>
+#include <Concurrent/Fiber.hpp>
+
+#include <unistd.h>
+#include <stdlib.h>
+#include <string.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+namespace Concurrent
+{
+	UnitTest::Suite RingTestSuite {
+		"Concurrent::Ring",
+		
+		{"it should write, sync and read a file",
+			[](UnitTest::Examiner & examiner) {
+				Ring ring;
+				
+				char path[] = "/tmp/Concurrent-Ring-XXXXXX";
+				int descriptor = ::mkstemp(path);
+				::unlink(path);
+				
+				std::string buffer(11, '\0');
+				std::size_t written = 0, read = 0;
+				
+				Fiber fiber([&]{
+					written = ring.write(descriptor, "Hello World", 11, 0);
+					ring.fsync(descriptor);
+					read = ring.read(descriptor, &buffer[0], buffer.size(), 0);
+				});
+				
+				fiber.resume();
+				ring.run();
+				
+				examiner.expect(fiber.status()) == Status::FINISHED;
+				examiner.expect(written) == 11;
+				examiner.expect(read) == 11;
+				examiner.expect(buffer) == "Hello World";
+				
+				::close(descriptor);
+			}
+		},
+		
+		{"it should suspend until a pipe has data",
+			[](UnitTest::Examiner & examiner) {
+				Ring ring;
+				int pipe[2];
+				
+				examiner.expect(::pipe(pipe)) == 0;
+				
+				char buffer[8] = {0};
+				std::size_t read = 0;
+				
+				Fiber reader([&]{
+					read = ring.read(pipe[0], buffer, sizeof(buffer));
+				});
+				
+				Fiber writer([&]{
+					ring.write(pipe[1], "data", 4);
+				});
+				
+				reader.resume();
+				writer.resume();
+				ring.run();
+				
+				examiner.expect(read) == 4;
+				examiner.expect(std::string(buffer, read)) == "data";
+				
+				::close(pipe[0]);
+				::close(pipe[1]);
+			}
+		},
+		
+		{"it should read and write using fixed buffers",
+			[](UnitTest::Examiner & examiner) {
+				Ring ring(Ring::DEFAULT_ENTRIES, 2, 4096);
+				int pipe[2];
+				
+				examiner.expect(::pipe(pipe)) == 0;
+				
+				auto input = ring.acquire();
+				auto output = ring.acquire();
+				
+				memcpy(output.data, "fixed", 5);
+				std::size_t read = 0;
+				
+				Fiber fiber([&]{
+					ring.write_fixed(pipe[1], output, 5);
+					read = ring.read_fixed(pipe[0], input, input.size);
+				});
+				
+				fiber.resume();
+				ring.run();
+				
+				examiner.expect(read) == 5;
+				examiner.expect(std::string((char *)input.data, read)) == "fixed";
+				
+				ring.release(input);
+				ring.release(output);
+				
+				::close(pipe[0]);
+				::close(pipe[1]);
+			}
+		},
+		
+		{"it should accept connections",
+			[](UnitTest::Examiner & examiner) {
+				Ring ring;
+				
+				int server = ::socket(AF_INET, SOCK_STREAM, 0);
+				
+				sockaddr_in address = {};
+				address.sin_family = AF_INET;
+				address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+				socklen_t length = sizeof(address);
+				
+				examiner.expect(::bind(server, (sockaddr *)&address, sizeof(address))) == 0;
+				examiner.expect(::listen(server, 1)) == 0;
+				::getsockname(server, (sockaddr *)&address, &length);
+				
+				int peer = -1;
+				
+				Fiber fiber([&]{
+					peer = ring.accept(server);
+				});
+				
+				fiber.resume();
+				
+				int client = ::socket(AF_INET, SOCK_STREAM, 0);
+				examiner.expect(::connect(client, (sockaddr *)&address, sizeof(address))) == 0;
+				
+				ring.run();
+				
+				examiner.expect(peer) >= 0;
+				
+				::close(peer);
+				::close(client);
+				::close(server);
+			}
+		},
+		
+		{"it should not unwind a stopped fiber until the kernel has finished with its buffer",
+			[](UnitTest::Examiner & examiner) {
+				Ring ring;
+				int pipe[2];
+				
+				examiner.expect(::pipe(pipe)) == 0;
+				
+				bool stopped = false, intact = false;
+				
+				Fiber fiber([&]{
+					char buffer[16];
+					memset(buffer, 'x', sizeof(buffer));
+					
+					try {
+						ring.read(pipe[0], buffer, sizeof(buffer));
+					} catch (Stop) {
+						stopped = true;
+					}
+					
+					intact = std::string(buffer, sizeof(buffer)) == std::string(sizeof(buffer), 'x');
+				});
+				
+				fiber.resume();
+				ring.update(false);
+				
+				fiber.request_stop();
+				
+				// The read is cancelled, but the fiber waits for the kernel to complete it:
+				examiner.expect(stopped) == false;
+				examiner.expect(fiber.status()) != Status::FINISHED;
+				
+				ring.update(false);
+				examiner.expect(::write(pipe[1], "data", 4)) == 4;
+				
+				ring.run();
+				
+				examiner.expect(stopped) == true;
+				examiner.expect(intact) == true;
+				examiner.expect(fiber.status()) == Status::FINISHED;
+				
+				// The data written after the read was cancelled is still in the pipe:
+				char buffer[8] = {0};
+				examiner.expect(::read(pipe[0], buffer, sizeof(buffer))) == 4;
+				
+				::close(pipe[0]);
+				::close(pipe[1]);
+			}
+		},
+		
+		{"it should report errors as exceptions",
+			[](UnitTest::Examiner & examiner) {
+				Ring ring;
+				bool failed = false;
+				char buffer[8];
+				
+				Fiber fiber([&]{
+					try {
+						ring.read(-1, buffer, sizeof(buffer));
+					} catch (const std::system_error & error) {
+						failed = true;
+					}
+				});
+				
+				fiber.resume();
+				ring.run();
+				
+				examiner.expect(failed) == true;
+			}
+		},
+	};
+}
@@ -0,0 +1,158 @@
+//
+//  Test.Scheduler.cpp
+//  This file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Concurrent/Scheduler.hpp>
+
+#include <set>
+
+namespace Concurrent
+{
+	UnitTest::Suite SchedulerTestSuite {
+		"Concurrent::Scheduler",
+		
+		{"it should run all spawned fibers",
+			[](UnitTest::Examiner & examiner) {
+				Scheduler scheduler(4);
+				std::atomic<std::size_t> count{0};
+				
+				for (std::size_t i = 0; i < 100; i += 1) {
+					scheduler.spawn([&]{
+						count += 1;
+					});
+				}
+				
+				scheduler.wait();
+				
+				examiner.expect(count.load()) == 100;
+				examiner.expect(scheduler.count()) == 0;
+			}
+		},
+		
+		{"it should resume yielding fibers",
+			[](UnitTest::Examiner & examiner) {
+				Scheduler scheduler(4, 1024*64);
+				std::atomic<std::size_t> count{0};
+				
+				for (std::size_t i = 0; i < 100; i += 1) {
+					scheduler.spawn([&]{
+						for (std::size_t j = 0; j < 10; j += 1) {
+							Scheduler::yield();
+							count += 1;
+						}
+					});
+				}
+				
+				scheduler.wait();
+				
+				examiner.expect(count.load()) == 1000;
+			}
+		},
+		
+		{"it should enqueue fibers waiting on a condition",
+			[](UnitTest::Examiner & examiner) {
+				Scheduler scheduler(1);
+				Condition condition;
+				std::string order;
+				
+				scheduler.spawn([&]{
+					order += 'A';
+					condition.wait();
+					order += 'D';
+				});
+				
+				scheduler.spawn([&]{
+					order += 'B';
+					condition.resume();
+					order += 'C';
+				});
+				
+				scheduler.wait();
+				
+				// The waiting fiber is not resumed until the signalling fiber yields back to the worker:
+				examiner.expect(order) == "ABCD";
+			}
+		},
+		
+		{"it should wake fibers across workers",
+			[](UnitTest::Examiner & examiner) {
+				Scheduler scheduler(4, 1024*64);
+				Condition condition;
+				std::atomic<std::size_t> woken{0};
+				
+				const std::size_t WAITERS = 100;
+				
+				for (std::size_t i = 0; i < WAITERS; i += 1) {
+					scheduler.spawn([&]{
+						condition.wait();
+						woken += 1;
+					});
+				}
+				
+				scheduler.spawn([&]{
+					while (woken.load() < WAITERS) {
+						condition.resume();
+						Scheduler::yield();
+					}
+				});
+				
+				scheduler.wait();
+				
+				examiner.expect(woken.load()) == WAITERS;
+			}
+		},
+		
+		{"it should resume sleeping fibers",
+			[](UnitTest::Examiner & examiner) {
+				Scheduler scheduler(2, 1024*64);
+				std::atomic<std::size_t> count{0};
+				
+				auto start = Timer::Clock::now();
+				
+				for (std::size_t i = 0; i < 10; i += 1) {
+					scheduler.spawn([&]{
+						Fiber::sleep(std::chrono::milliseconds(10));
+						count += 1;
+					});
+				}
+				
+				scheduler.wait();
+				
+				examiner.expect(count.load()) == 10;
+				examiner.expect(Timer::Clock::now() - start >= std::chrono::milliseconds(10)) == true;
+			}
+		},
+		
+		{"it should stop fibers waiting on a destroyed condition",
+			[](UnitTest::Examiner & examiner) {
+				Scheduler scheduler(2);
+				std::atomic<bool> stopped{false};
+				
+				{
+					Condition condition;
+					
+					scheduler.spawn([&]{
+						try {
+							condition.wait();
+						} catch (Stop) {
+							stopped = true;
+							throw;
+						}
+					});
+					
+					while (condition.count() == 0) std::this_thread::yield();
+				}
+				
+				scheduler.wait();
+				
+				examiner.expect(stopped.load()) == true;
+			}
+		},
+	};
+}
@@ -0,0 +1,143 @@
+//
+//  Test.Semaphore.cpp
+//  This file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Concurrent/Semaphore.hpp>
+#include <Concurrent/Scheduler.hpp>
+
+#include <atomic>
+#include <thread>
+
+namespace Concurrent
+{
+	UnitTest::Suite SemaphoreTestSuite {
+		"Concurrent::Semaphore",
+		
+		{"it should count available units",
+			[](UnitTest::Examiner & examiner) {
+				Semaphore semaphore(2);
+				
+				examiner.expect(semaphore.try_acquire()) == true;
+				examiner.expect(semaphore.try_acquire()) == true;
+				examiner.expect(semaphore.try_acquire()) == false;
+				
+				semaphore.release(2);
+				
+				examiner.expect(semaphore.available()) == 2;
+			}
+		},
+		
+		{"it should hand released units to waiting fibers",
+			[](UnitTest::Examiner & examiner) {
+				Semaphore semaphore;
+				std::size_t acquired = 0;
+				
+				Fiber first([&]{semaphore.acquire(); acquired += 1;});
+				Fiber second([&]{semaphore.acquire(); acquired += 1;});
+				
+				first.resume();
+				second.resume();
+				
+				examiner.expect(semaphore.count()) == 2;
+				
+				semaphore.release(3);
+				
+				examiner.expect(acquired) == 2;
+				examiner.expect(semaphore.available()) == 1;
+			}
+		},
+		
+		{"it should raise Stop in fibers asked to stop while waiting",
+			[](UnitTest::Examiner & examiner) {
+				Semaphore semaphore;
+				bool stopped = false;
+				
+				Fiber fiber([&]{
+					try {
+						semaphore.acquire();
+					} catch (Stop) {
+						stopped = true;
+						throw;
+					}
+				});
+				
+				fiber.resume();
+				
+				examiner.expect(semaphore.count()) == 1;
+				
+				fiber.request_stop();
+				
+				examiner.expect(stopped) == true;
+				examiner.expect(semaphore.count()) == 0;
+				examiner.expect(bool(fiber)) == false;
+				
+				// The released unit isn't handed to the stopped fiber:
+				semaphore.release();
+				examiner.expect(semaphore.available()) == 1;
+			}
+		},
+		
+		{"it should raise Stop in fibers run by a scheduler when they are asked to stop",
+			[](UnitTest::Examiner & examiner) {
+				Scheduler scheduler(2, 1024*64);
+				Semaphore semaphore;
+				Fiber * waiting = nullptr;
+				std::atomic<bool> stopped{false};
+				
+				scheduler.spawn([&]{
+					waiting = Fiber::current;
+					
+					try {
+						semaphore.acquire();
+					} catch (Stop) {
+						stopped = true;
+						throw;
+					}
+				});
+				
+				while (semaphore.count() == 0) std::this_thread::yield();
+				
+				waiting->request_stop();
+				scheduler.wait();
+				
+				examiner.expect(stopped.load()) == true;
+				examiner.expect(semaphore.count()) == 0;
+			}
+		},
+		
+		{"it should limit concurrency across workers",
+			[](UnitTest::Examiner & examiner) {
+				Scheduler scheduler(4, 1024*64);
+				Semaphore semaphore(3);
+				std::atomic<std::size_t> active{0}, maximum{0};
+				
+				for (std::size_t i = 0; i < 100; i += 1) {
+					scheduler.spawn([&]{
+						semaphore.acquire();
+						
+						auto current = active.fetch_add(1) + 1;
+						
+						auto previous = maximum.load();
+						while (previous < current && !maximum.compare_exchange_weak(previous, current));
+						
+						Scheduler::yield();
+						
+						active -= 1;
+						semaphore.release();
+					});
+				}
+				
+				scheduler.wait();
+				
+				examiner.expect(maximum.load() <= 3) == true;
+				examiner.expect(semaphore.available()) == 3;
+			}
+		},
+	};
+}
@@ -0,0 +1,100 @@
+//
+//  Test.SharedMutex.cpp
+//  This file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Concurrent/SharedMutex.hpp>
+#include <Concurrent/Scheduler.hpp>
+
+#include <shared_mutex>
+
+namespace Concurrent
+{
+	UnitTest::Suite SharedMutexTestSuite {
+		"Concurrent::SharedMutex",
+		
+		{"it should allow many readers or one writer",
+			[](UnitTest::Examiner & examiner) {
+				SharedMutex mutex;
+				
+				examiner.expect(mutex.try_lock_shared()) == true;
+				examiner.expect(mutex.try_lock_shared()) == true;
+				examiner.expect(mutex.try_lock()) == false;
+				
+				mutex.unlock_shared();
+				mutex.unlock_shared();
+				
+				examiner.expect(mutex.try_lock()) == true;
+				examiner.expect(mutex.try_lock_shared()) == false;
+				
+				mutex.unlock();
+			}
+		},
+		
+		{"it should queue readers behind waiting writers",
+			[](UnitTest::Examiner & examiner) {
+				SharedMutex mutex;
+				std::string order;
+				
+				mutex.lock_shared();
+				
+				Fiber writer([&]{mutex.lock(); order += 'W'; mutex.unlock();});
+				Fiber first([&]{mutex.lock_shared(); order += 'R'; mutex.unlock_shared();});
+				Fiber second([&]{mutex.lock_shared(); order += 'R'; mutex.unlock_shared();});
+				
+				writer.resume();
+				first.resume();
+				second.resume();
+				
+				// The readers can't overtake the writer:
+				examiner.expect(order) == "";
+				
+				mutex.unlock_shared();
+				
+				examiner.expect(order) == "WRR";
+				examiner.expect(mutex.try_lock()) == true;
+				
+				mutex.unlock();
+			}
+		},
+		
+		{"it should exclude writers on different workers",
+			[](UnitTest::Examiner & examiner) {
+				Scheduler scheduler(4, 1024*64);
+				SharedMutex mutex;
+				std::size_t value = 0;
+				std::atomic<bool> consistent{true};
+				
+				for (std::size_t i = 0; i < 100; i += 1) {
+					scheduler.spawn([&, i]{
+						for (std::size_t j = 0; j < 100; j += 1) {
+							if (i % 4 == 0) {
+								std::unique_lock<SharedMutex> lock(mutex);
+								
+								// Readers must never see the value while it is odd:
+								value += 1;
+								Scheduler::yield();
+								value += 1;
+							} else {
+								std::shared_lock<SharedMutex> lock(mutex);
+								
+								if (value % 2) consistent = false;
+								Scheduler::yield();
+							}
+						}
+					});
+				}
+				
+				scheduler.wait();
+				
+				examiner.expect(value) == 25 * 100 * 2;
+				examiner.expect(consistent.load()) == true;
+			}
+		},
+	};
+}
@@ -0,0 +1,92 @@
+//
+//  Test.Sizing.cpp
+//  This file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Concurrent/Sizing.hpp>
+#include <Concurrent/Scheduler.hpp>
+
+#include <sstream>
+
+namespace Concurrent
+{
+	UnitTest::Suite SizingTestSuite {
+		"Concurrent::Sizing",
+		
+		{"it should choose stack sizes from the peak usage",
+			[](UnitTest::Examiner & examiner) {
+				Sizing sizing(1024*16, 1024*1024, 2.0);
+				
+				examiner.expect(sizing.stack_size("request")) == 1024*1024;
+				
+				sizing.record("request", 1024*20);
+				sizing.record("request", 1024*40);
+				sizing.record("request", 1024*30);
+				sizing.record("tiny", 1024);
+				sizing.record("huge", 1024*1024);
+				
+				examiner.expect(sizing.usage("request").samples) == 3;
+				examiner.expect(sizing.usage("request").peak) == 1024*40;
+				
+				examiner.expect(sizing.stack_size("request")) == 1024*80;
+				examiner.expect(sizing.stack_size("tiny")) == 1024*16;
+				examiner.expect(sizing.stack_size("huge")) == 1024*1024;
+			}
+		},
+		
+		{"it should load the report it writes",
+			[](UnitTest::Examiner & examiner) {
+				Sizing sizing;
+				
+				sizing.record("accept loop", 1024*8);
+				sizing.record("request", 1024*100);
+				
+				std::stringstream report;
+				sizing.report(report);
+				
+				Sizing loaded;
+				loaded.load(report);
+				
+				examiner.expect(loaded.usage("accept loop").peak) == 1024*8;
+				examiner.expect(loaded.stack_size("accept loop")) == sizing.stack_size("accept loop");
+				examiner.expect(loaded.stack_size("request")) == sizing.stack_size("request");
+			}
+		},
+		
+		{"it should size the stacks of scheduled fibers",
+			[](UnitTest::Examiner & examiner) {
+				Sizing sizing(1024*16, 1024*1024);
+				
+				{
+					Scheduler scheduler(2, 1024*1024);
+					scheduler.track(&sizing);
+					
+					for (std::size_t i = 0; i < 10; i += 1) {
+						scheduler.spawn("small", []{
+							Scheduler::yield();
+						});
+						
+						scheduler.spawn("large", []{
+							volatile char buffer[1024*100];
+							
+							for (std::size_t offset = 0; offset < sizeof(buffer); offset += 1024) {
+								buffer[offset] = 1;
+							}
+						});
+					}
+				}
+				
+				examiner.expect(sizing.usage("small").samples) == 10;
+				examiner.expect(sizing.usage("large").peak) >= 1024*100;
+				
+				examiner.expect(sizing.stack_size("small")) < sizing.stack_size("large");
+				examiner.expect(sizing.stack_size("large")) >= 1024*200;
+			}
+		},
+	};
+}
@@ -9,9 +9,31 @@
 #include <UnitTest/UnitTest.hpp>
 
 #include <Concurrent/Stack.hpp>
+#include <Concurrent/Fiber.hpp>
+
+#include <system_error>
+#include <initializer_list>
+
+#if defined(__linux__)
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/mempolicy.h>
+#endif
 
 namespace Concurrent
 {
+#if defined(__linux__)
+	// The memory policy of the mapping which contains the address, or -1 if it can't be determined, e.g. in a sandbox:
+	static int memory_policy(void * address)
+	{
+		int mode = -1;
+		
+		if (::syscall(SYS_get_mempolicy, &mode, nullptr, 0, address, MPOL_F_ADDR) == -1) return -1;
+		
+		return mode;
+	}
+#endif
+	
 	struct Move
 	{
 		std::size_t value;
@@ -53,5 +75,128 @@ namespace Concurrent
 				examiner.expect(current->value) == 10;
 			}
 		},
+		
+		{"can measure the stack usage of a fiber",
+			[](UnitTest::Examiner & examiner) {
+				Fiber fiber([]{
+					volatile char buffer[1024*64];
+					
+					for (std::size_t offset = 0; offset < sizeof(buffer); offset += 1024) {
+						buffer[offset] = 1;
+					}
+				}, 1024*1024);
+				
+				examiner.expect(fiber.stack().used()) < 1024*64;
+				
+				fiber.resume();
+				
+				examiner.expect(fiber.stack().used()) >= 1024*64;
+				examiner.expect(fiber.stack().used()) < 1024*1024;
+				
+				fiber.stack().discard();
+				
+				examiner.expect(fiber.stack().used()) == 0;
+			}
+		},
+		
+		{"can place stacks on the local node with huge pages",
+			[](UnitTest::Examiner & examiner) {
+				Stack::Options options{Stack::Options::LOCAL_NODE, true};
+				Stack::Arena arena(1024*64, 4, Stack::Arena::DEFAULT_GUARD_INTERVAL, options);
+				
+				int x = 0;
+				
+				Fiber first([&]{x += 1;}, 1024*64, options);
+				Fiber second(arena.allocate(), [&]{x += 1;});
+				
+				// Both stacks prefer the local node, if the kernel reports memory policies:
+#if defined(__linux__)
+				for (auto fiber : {&first, &second}) {
+					auto mode = memory_policy(fiber->stack().bottom());
+					
+					if (mode != -1) examiner.expect(mode) == MPOL_PREFERRED;
+				}
+#endif
+				
+				first.resume();
+				second.resume();
+				
+				examiner.expect(x) == 2;
+			}
+		},
+		
+		{"can allocate stacks from an arena",
+			[](UnitTest::Examiner & examiner) {
+				Stack::Arena arena(1024*16, 4);
+				
+				examiner.expect(arena.stack_size()) >= 1024*16;
+				
+				{
+					Stack first = arena.allocate(), second = arena.allocate();
+					
+					examiner.expect(first.arena()) == &arena;
+					examiner.expect(first.size()) == arena.stack_size();
+					examiner.expect(second.top() <= first.bottom() || first.top() <= second.bottom()) == true;
+					
+					examiner.expect(arena.count()) == 2;
+				}
+				
+				examiner.expect(arena.count()) == 0;
+			}
+		},
+		
+		{"reuses the most recently freed arena slot",
+			[](UnitTest::Examiner & examiner) {
+				Stack::Arena arena(1024*16, 2);
+				void * top = nullptr;
+				
+				{
+					Stack stack = arena.allocate();
+					top = stack.top();
+				}
+				
+				Stack stack = arena.allocate();
+				
+				examiner.expect(stack.top()) == top;
+			}
+		},
+		
+		{"throws when the arena is exhausted",
+			[](UnitTest::Examiner & examiner) {
+				Stack::Arena arena(1024*16, 1);
+				Stack stack = arena.allocate();
+				
+				bool thrown = false;
+				
+				try {
+					arena.allocate();
+				} catch (const std::system_error & error) {
+					thrown = true;
+				}
+				
+				examiner.expect(thrown) == true;
+			}
+		},
+		
+		{"can run fibers on arena stacks",
+			[](UnitTest::Examiner & examiner) {
+				Stack::Arena arena(1024*64, 16, 4);
+				std::size_t count = 0;
+				
+				{
+					Fiber::Pool pool(arena, 4);
+					
+					for (std::size_t i = 0; i < 100; i += 1) {
+						pool.resume([&]{
+							Fiber::current->yield();
+							count += 1;
+						}).resume();
+					}
+				}
+				
+				examiner.expect(count) == 100;
+				examiner.expect(arena.count()) == 0;
+			}
+		},
 	};
 }
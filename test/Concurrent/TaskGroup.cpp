@@ -0,0 +1,207 @@
+//
+//  Test.TaskGroup.cpp
+//  This file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Concurrent/TaskGroup.hpp>
+#include <Concurrent/Condition.hpp>
+#include <Concurrent/Semaphore.hpp>
+#include <Concurrent/Loop.hpp>
+
+#include <string>
+#include <stdexcept>
+#include <system_error>
+
+namespace Concurrent
+{
+	static const std::size_t STACK_SIZE = 1024*64;
+	
+	UnitTest::Suite TaskGroupTestSuite {
+		"Concurrent::TaskGroup",
+		
+		{"it should join tasks and return their results",
+			[](UnitTest::Examiner & examiner) {
+				Loop loop;
+				
+				Condition condition;
+				std::string result;
+				
+				Fiber fiber([&]{
+					TaskGroup group(STACK_SIZE);
+					
+					auto first = group.spawn([&]{condition.wait(); return std::string("first");});
+					auto second = group.spawn([&]{condition.wait(); return 2;});
+					auto third = group.spawn([&]{});
+					
+					examiner.expect(group.running()) == 2;
+					examiner.expect(third.finished()) == true;
+					
+					group.join();
+					
+					result = first.get() + std::to_string(second.get());
+				});
+				
+				fiber.resume();
+				
+				examiner.expect(result) == "";
+				
+				condition.resume();
+				loop.run();
+				
+				examiner.expect(result) == "first2";
+				examiner.expect(bool(fiber)) == false;
+			}
+		},
+		
+		{"it should join tasks without a loop and then be destroyed",
+			[](UnitTest::Examiner & examiner) {
+				Condition condition;
+				std::string result;
+				
+				Fiber fiber([&]{
+					TaskGroup group(STACK_SIZE);
+					
+					auto user = group.spawn([&]{condition.wait(); return std::string("user");});
+					auto orders = group.spawn([&]{condition.wait(); return 2;});
+					
+					group.join();
+					
+					result = user.get() + std::to_string(orders.get());
+				});
+				
+				fiber.resume();
+				
+				// The last task wakes the joining fiber, which destroys the group once the task has exited:
+				condition.resume();
+				
+				examiner.expect(result) == "user2";
+				examiner.expect(bool(fiber)) == false;
+			}
+		},
+		
+		{"it should wait for a task without a loop and then be destroyed",
+			[](UnitTest::Examiner & examiner) {
+				Condition condition;
+				std::size_t result = 0;
+				
+				Fiber fiber([&]{
+					TaskGroup group(STACK_SIZE);
+					
+					auto task = group.spawn([&]{condition.wait(); return 42;});
+					
+					result = task.get();
+				});
+				
+				fiber.resume();
+				condition.resume();
+				
+				examiner.expect(result) == 42;
+				examiner.expect(bool(fiber)) == false;
+			}
+		},
+		
+		{"it should cancel the other tasks when one fails",
+			[](UnitTest::Examiner & examiner) {
+				Loop loop;
+				
+				Condition condition;
+				Semaphore semaphore;
+				std::size_t waits = 0;
+				std::string error;
+				bool cancelled = false;
+				
+				Fiber fiber([&]{
+					TaskGroup group(STACK_SIZE);
+					
+					group.spawn([&]{
+						condition.wait();
+						
+						throw std::runtime_error("failed");
+					});
+					
+					// Returns normally once it is asked to stop:
+					auto waiting = group.spawn([&]{
+						while (condition.wait()) waits += 1;
+						
+						return waits;
+					});
+					
+					// Is unwound by Stop:
+					auto acquiring = group.spawn([&]{
+						semaphore.acquire();
+					});
+					
+					try {
+						group.join();
+					} catch (const std::runtime_error & exception) {
+						error = exception.what();
+					}
+					
+					examiner.expect(waiting.get()) == 0;
+					
+					try {
+						acquiring.get();
+					} catch (const std::system_error & exception) {
+						cancelled = exception.code() == std::errc::operation_canceled;
+					}
+				});
+				
+				fiber.resume();
+				condition.resume();
+				loop.run();
+				
+				examiner.expect(error) == "failed";
+				examiner.expect(cancelled) == true;
+				examiner.expect(semaphore.count()) == 0;
+				examiner.expect(bool(fiber)) == false;
+			}
+		},
+		
+		{"it should stop tasks which are running when it is destroyed",
+			[](UnitTest::Examiner & examiner) {
+				Condition condition;
+				std::size_t stopped = 0;
+				
+				{
+					TaskGroup group(STACK_SIZE);
+					
+					for (std::size_t i = 0; i < 3; i += 1) {
+						group.spawn([&]{
+							if (!condition.wait()) stopped += 1;
+						});
+					}
+					
+					examiner.expect(group.running()) == 3;
+				}
+				
+				examiner.expect(stopped) == 3;
+				examiner.expect(condition.count()) == 0;
+			}
+		},
+		
+		{"it should allocate task stacks from an arena",
+			[](UnitTest::Examiner & examiner) {
+				Stack::Arena arena(STACK_SIZE, 4);
+				
+				{
+					TaskGroup group(arena);
+					
+					for (std::size_t i = 0; i < 4; i += 1) {
+						auto task = group.spawn([i]{return i * 2;});
+						
+						examiner.expect(task.get()) == i * 2;
+					}
+					
+					examiner.expect(arena.count()) == 4;
+				}
+				
+				examiner.expect(arena.count()) == 0;
+			}
+		},
+	};
+}
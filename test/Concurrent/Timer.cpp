@@ -0,0 +1,156 @@
+//
+//  Test.Timer.cpp
+//  This file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Concurrent/Timer.hpp>
+#include <Concurrent/Fiber.hpp>
+
+namespace Concurrent
+{
+	class Counter : public Timer
+	{
+	public:
+		std::size_t count = 0;
+		
+	protected:
+		void expire() override
+		{
+			count += 1;
+		}
+	};
+	
+	UnitTest::Suite TimerTestSuite {
+		"Concurrent::Timer",
+		
+		{"it should expire once the deadline has passed",
+			[](UnitTest::Examiner & examiner) {
+				auto start = Timer::Clock::now();
+				Timer::Wheel wheel(std::chrono::milliseconds(1), start);
+				Counter timer;
+				
+				wheel.insert(timer, std::chrono::milliseconds(10), start);
+				examiner.expect(wheel.count()) == 1;
+				
+				examiner.expect(wheel.update(start + std::chrono::milliseconds(9))) == 0;
+				examiner.expect(timer.count) == 0;
+				
+				examiner.expect(wheel.update(start + std::chrono::milliseconds(10))) == 1;
+				examiner.expect(timer.count) == 1;
+				examiner.expect(timer.scheduled()) == false;
+				examiner.expect(wheel.count()) == 0;
+			}
+		},
+		
+		{"it should expire timers at higher levels",
+			[](UnitTest::Examiner & examiner) {
+				auto start = Timer::Clock::now();
+				Timer::Wheel wheel(std::chrono::milliseconds(1), start);
+				Counter near, far, further;
+				
+				wheel.insert(near, std::chrono::milliseconds(300), start);
+				wheel.insert(far, std::chrono::milliseconds(70000), start);
+				wheel.insert(further, std::chrono::milliseconds(20000000), start);
+				
+				wheel.update(start + std::chrono::milliseconds(299));
+				examiner.expect(near.count) == 0;
+				
+				wheel.update(start + std::chrono::milliseconds(300));
+				examiner.expect(near.count) == 1;
+				
+				wheel.update(start + std::chrono::milliseconds(69999));
+				examiner.expect(far.count) == 0;
+				
+				wheel.update(start + std::chrono::milliseconds(70000));
+				examiner.expect(far.count) == 1;
+				
+				wheel.update(start + std::chrono::milliseconds(19999999));
+				examiner.expect(further.count) == 0;
+				
+				wheel.update(start + std::chrono::milliseconds(20000000));
+				examiner.expect(further.count) == 1;
+			}
+		},
+		
+		{"it should not expire cancelled timers",
+			[](UnitTest::Examiner & examiner) {
+				auto start = Timer::Clock::now();
+				Timer::Wheel wheel(std::chrono::milliseconds(1), start);
+				Counter timer;
+				
+				wheel.insert(timer, std::chrono::milliseconds(10), start);
+				timer.cancel();
+				
+				examiner.expect(wheel.count()) == 0;
+				examiner.expect(wheel.update(start + std::chrono::milliseconds(20))) == 0;
+				examiner.expect(timer.count) == 0;
+			}
+		},
+		
+		{"it should report the time until the next deadline",
+			[](UnitTest::Examiner & examiner) {
+				auto start = Timer::Clock::now();
+				Timer::Wheel wheel(std::chrono::milliseconds(1), start);
+				Counter timer;
+				
+				examiner.expect(wheel.timeout(start) == Timer::Clock::duration::max()) == true;
+				
+				wheel.insert(timer, std::chrono::milliseconds(10), start);
+				examiner.expect(wheel.timeout(start) == std::chrono::milliseconds(10)) == true;
+				
+				wheel.insert(timer, std::chrono::milliseconds(0), start);
+				examiner.expect(wheel.timeout(start) == Timer::Clock::duration::zero()) == true;
+			}
+		},
+		
+		{"it should sleep a fiber",
+			[](UnitTest::Examiner & examiner) {
+				auto & wheel = Timer::Wheel::local();
+				auto start = Timer::Clock::now();
+				
+				Fiber fiber([&]{
+					Fiber::sleep(std::chrono::milliseconds(10));
+				});
+				
+				fiber.resume();
+				
+				while (fiber) {
+					wheel.update();
+				}
+				
+				examiner.expect(Timer::Clock::now() - start >= std::chrono::milliseconds(10)) == true;
+			}
+		},
+		
+		{"it should time out waiting on a condition",
+			[](UnitTest::Examiner & examiner) {
+				auto & wheel = Timer::Wheel::local();
+				Condition condition;
+				bool resumed = true, signalled = false;
+				
+				Fiber fiber([&]{
+					resumed = condition.wait_for(std::chrono::milliseconds(5));
+					signalled = condition.wait_for(std::chrono::seconds(10));
+				});
+				
+				fiber.resume();
+				
+				while (resumed) {
+					wheel.update();
+				}
+				
+				// Now waiting again, with a much longer timeout:
+				examiner.expect(condition.count()) == 1;
+				condition.resume();
+				
+				examiner.expect(signalled) == true;
+				examiner.expect(wheel.count()) == 0;
+			}
+		},
+	};
+}
@@ -0,0 +1,153 @@
+//
+//  Test.Trace.cpp
+//  This file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Concurrent/Trace.hpp>
+
+#if !defined(CONCURRENT_NO_TRACE)
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace Concurrent
+{
+	// The types of the events recorded on this thread which involve the given fiber:
+	static std::vector<Trace::Type> types_of(const Fiber & fiber)
+	{
+		std::vector<Trace::Type> types;
+		
+		for (auto & event : Trace::events()) {
+			if (event.fiber == &fiber) types.push_back(event.type);
+		}
+		
+		return types;
+	}
+	
+	UnitTest::Suite TraceTestSuite {
+		"Concurrent::Trace",
+		
+		{"it should record fiber switches",
+			[](UnitTest::Examiner & examiner) {
+				Trace::start();
+				
+				Fiber fiber("worker", [&]{
+					Fiber::current->yield();
+				});
+				
+				fiber.resume();
+				fiber.resume();
+				
+				Trace::stop();
+				
+				auto types = types_of(fiber);
+				
+				examiner.expect(types.size()) == 4;
+				examiner.expect(types[0] == Trace::Type::RESUME) == true;
+				examiner.expect(types[1] == Trace::Type::YIELD) == true;
+				examiner.expect(types[2] == Trace::Type::RESUME) == true;
+				examiner.expect(types[3] == Trace::Type::RETURN) == true;
+				
+				examiner.expect(std::string(Trace::events().front().annotation)) == "worker";
+			}
+		},
+		
+		{"it should record condition waits and signals",
+			[](UnitTest::Examiner & examiner) {
+				Condition condition;
+				
+				Trace::start();
+				
+				Fiber fiber([&]{
+					condition.wait();
+				});
+				
+				fiber.resume();
+				condition.signal();
+				
+				Trace::stop();
+				
+				auto types = types_of(fiber);
+				
+				examiner.expect(types.size()) == 6;
+				examiner.expect(types[1] == Trace::Type::WAIT) == true;
+				examiner.expect(types[2] == Trace::Type::YIELD) == true;
+				examiner.expect(types[3] == Trace::Type::SIGNAL) == true;
+				examiner.expect(types[4] == Trace::Type::RESUME) == true;
+				
+				for (auto & event : Trace::events()) {
+					if (event.type == Trace::Type::SIGNAL) {
+						examiner.expect(event.condition == &condition) == true;
+					}
+				}
+			}
+		},
+		
+		{"it should not record events once stopped",
+			[](UnitTest::Examiner & examiner) {
+				Trace::start();
+				Trace::stop();
+				
+				Fiber fiber([&]{});
+				fiber.resume();
+				
+				examiner.expect(Trace::events().size()) == 0;
+			}
+		},
+		
+		{"it should keep the most recent events",
+			[](UnitTest::Examiner & examiner) {
+				Trace::start();
+				
+				bool done = false;
+				
+				Fiber fiber([&]{
+					while (!done) Fiber::current->yield();
+				});
+				
+				for (std::size_t i = 0; i < Trace::DEFAULT_CAPACITY; i += 1) {
+					fiber.resume();
+				}
+				
+				done = true;
+				fiber.resume();
+				
+				Trace::stop();
+				
+				auto events = Trace::events();
+				
+				examiner.expect(events.size()) == Trace::DEFAULT_CAPACITY;
+				examiner.expect(events.back().type == Trace::Type::RETURN) == true;
+			}
+		},
+		
+		{"it should write a Chrome trace",
+			[](UnitTest::Examiner & examiner) {
+				Trace::start();
+				
+				Fiber fiber("\"quoted\"", [&]{});
+				fiber.resume();
+				
+				Trace::stop();
+				
+				std::stringstream output;
+				Trace::write(output);
+				
+				auto trace = output.str();
+				
+				examiner.expect(trace.find("\"traceEvents\":[")) != std::string::npos;
+				examiner.expect(trace.find("{\"ph\":\"B\",\"name\":\"\\\"quoted\\\"\"")) != std::string::npos;
+				examiner.expect(trace.find("{\"ph\":\"E\",\"name\":\"\\\"quoted\\\"\"")) != std::string::npos;
+				examiner.expect(trace.substr(trace.size() - 4)) == "\n]}\n";
+			}
+		},
+	};
+}
+
+#endif
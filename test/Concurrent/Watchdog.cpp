@@ -0,0 +1,136 @@
+//
+//  Test.Watchdog.cpp
+//  This file is part of the "Concurrent" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Concurrent/Fiber.hpp>
+
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Concurrent
+{
+	// Collects the overruns reported by a watchdog, from any thread:
+	struct Overruns
+	{
+		std::mutex lock;
+		std::vector<Watchdog::Overrun> overruns;
+		
+		Watchdog::Report report()
+		{
+			return [this](const Watchdog::Overrun & overrun){
+				std::lock_guard<std::mutex> guard(lock);
+				overruns.push_back(overrun);
+			};
+		}
+	};
+	
+	// Use the CPU for the given duration, without switching, optionally checking the budget:
+	static void spin(Timer::Clock::duration duration, bool check = false)
+	{
+		auto deadline = Timer::Clock::now() + duration;
+		
+		while (Timer::Clock::now() < deadline) {
+			if (check) Fiber::maybe_yield();
+		}
+	}
+	
+	UnitTest::Suite WatchdogTestSuite {
+		"Concurrent::Watchdog",
+		
+		{"it should report a fiber which runs past the threshold",
+			[](UnitTest::Examiner & examiner) {
+				Overruns overruns;
+				
+				Fiber fiber("hog", [&]{
+					spin(std::chrono::milliseconds(100));
+				});
+				
+				{
+					Watchdog watchdog(std::chrono::milliseconds(10), overruns.report());
+					
+					fiber.resume();
+					
+					examiner.expect(watchdog.overruns()) == 1;
+				}
+				
+				examiner.expect(overruns.overruns.size()) == 1;
+				
+				auto & overrun = overruns.overruns.front();
+				examiner.expect(overrun.fiber == &fiber) == true;
+				examiner.expect(overrun.annotation) == "hog";
+				examiner.expect(overrun.running >= std::chrono::milliseconds(10)) == true;
+				examiner.expect(overrun.backtrace.empty()) == true;
+			}
+		},
+		
+		{"it should report a backtrace once the fiber checks its budget",
+			[](UnitTest::Examiner & examiner) {
+				Overruns overruns;
+				
+				Fiber fiber("hog", [&]{
+					spin(std::chrono::milliseconds(100), true);
+				});
+				
+				fiber.budget(Timer::Clock::duration::zero());
+				
+				{
+					Watchdog watchdog(std::chrono::milliseconds(10), overruns.report());
+					
+					fiber.resume();
+				}
+				
+				examiner.expect(overruns.overruns.size()) == 2;
+				
+				auto & overrun = overruns.overruns.back();
+				examiner.expect(overrun.fiber == &fiber) == true;
+				examiner.expect(overrun.backtrace.empty()) == false;
+			}
+		},
+		
+		{"it should not report fibers which yield within their budget",
+			[](UnitTest::Examiner & examiner) {
+				Overruns overruns;
+				
+				Fiber fiber("worker", [&]{
+					spin(std::chrono::milliseconds(100), true);
+				});
+				
+				fiber.budget(std::chrono::milliseconds(1));
+				
+				{
+					Watchdog watchdog(std::chrono::milliseconds(50), overruns.report());
+					
+					while (fiber) fiber.resume();
+					
+					// The main fiber is idle, however long it runs:
+					std::this_thread::sleep_for(std::chrono::milliseconds(100));
+				}
+				
+				examiner.expect(overruns.overruns.size()) == 0;
+			}
+		},
+		
+		{"it should only allow one watchdog at a time",
+			[](UnitTest::Examiner & examiner) {
+				Watchdog watchdog;
+				
+				bool thrown = false;
+				
+				try {
+					Watchdog other;
+				} catch (std::system_error &) {
+					thrown = true;
+				}
+				
+				examiner.expect(thrown) == true;
+			}
+		},
+	};
+}